@@ -5,7 +5,7 @@
 
 namespace ares {
 
-Platform* platform = nullptr;
-bool _runAhead = false;
+instance_local Platform* platform = nullptr;
+instance_local bool _runAhead = false;
 
 }
@@ -15,6 +15,7 @@
 #include <nall/endian.hpp>
 #include <nall/hashset.hpp>
 #include <nall/image.hpp>
+#include <nall/inline-function.hpp>
 #include <nall/literals.hpp>
 #include <nall/priority-queue.hpp>
 #include <nall/queue.hpp>
@@ -39,6 +40,15 @@
 using namespace nall;
 using namespace nall::primitives;
 
+//threaded instances: every host thread owns an independent copy of each instance_local object,
+//so that several instances of a core can run in parallel within one process, one per thread.
+//currently only the fc, gb and ms cores keep all of their state instance_local.
+#if defined(THREADED_INSTANCES)
+  #define instance_local thread_local
+#else
+  #define instance_local
+#endif
+
 namespace ares {
   static const string Name       = "ares";
   static const string Version    = "132";
@@ -57,7 +67,11 @@ namespace ares {
   }
 
   namespace Video {
+    #if defined(THREADED_INSTANCES)
+    static constexpr bool Threaded = false;  //screens are refreshed on their instance's thread
+    #else
     static constexpr bool Threaded = true;
+    #endif
   }
 
   namespace Constants {
@@ -67,13 +81,14 @@ namespace ares {
     }
   }
 
-  extern bool _runAhead;
+  extern instance_local bool _runAhead;
   inline auto runAhead() -> bool { return _runAhead; }
   inline auto setRunAhead(bool runAhead) -> void { _runAhead = runAhead; }
 }
 
 #include <ares/types.hpp>
 #include <ares/random.hpp>
+#include <ares/idle-loop.hpp>
 #include <ares/debug/debug.hpp>
 #include <ares/node/node.hpp>
 #include <ares/platform.hpp>
@@ -1,6 +1,6 @@
 namespace ares {
 
-Debug _debug;
+instance_local Debug _debug;
 
 auto Debug::reset() -> void {
   _totalNotices = 0;
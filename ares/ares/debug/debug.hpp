@@ -32,7 +32,7 @@ private:
   vector<string> _unverifiedNotices;
 };
 
-extern Debug _debug;
+extern instance_local Debug _debug;
 
 }
 
@@ -0,0 +1,140 @@
+#pragma once
+
+namespace ares {
+
+//detects short loops that only poll memory, such as a wait for vblank that does not use HALT.
+//once an iteration of such a loop has left the processor state unchanged without writing to
+//memory, every further iteration will do the same until a polled value changes or an interrupt
+//is raised. the core may then step time forward past these iterations instead of interpreting them.
+//
+//the processor calls instruction() before every instruction, and iterate() with its registers
+//whenever that returns true. the core reports the reads and writes of the processor, and uses
+//sample() and unchanged() with a side-effect free read to find out when the loop may exit.
+//
+//polled values are only compared once per skipped iteration, so a loop may exit up to one
+//iteration later than it would have. cores therefore expose skipping as a "Skip Idle Loops"
+//setting, which is off by default, and only peek at addresses that are known to be safe.
+
+struct IdleLoop {
+  static constexpr u32 Window       = 32;  //maximum loop size, in bytes
+  static constexpr u32 Instructions = 8;   //maximum loop size, in instructions
+  static constexpr u32 Registers    = 24;  //maximum processor state size, in words
+  static constexpr u32 Reads        = 16;  //maximum reads per iteration, including opcode fetches
+  static constexpr u32 Polls        = 2;   //maximum distinct data addresses polled per iteration
+  static constexpr u32 Iterations   = 64;  //maximum iterations skipped at once
+
+  explicit operator bool() const { return enable; }
+
+  auto setEnabled(bool enabled) -> void {
+    reset();
+    enable = enabled;
+  }
+
+  auto reset() -> void {
+    head = ~0;
+    last = ~0;
+    repeats = 0;
+    primed = false;
+  }
+
+  //returns true when address is the head of a candidate loop.
+  alwaysinline auto instruction(u32 address) -> bool {
+    if(address == head) return tail = last, last = address, true;
+    if(address < last && last - address <= Window) {
+      //a short backward branch was taken: track the new loop
+      head = address;
+      repeats = 0;
+      primed = false;
+      return tail = last, last = address, true;
+    }
+    if(++length > Instructions) pure = false;
+    return last = address, false;
+  }
+
+  //called at the loop head: returns true when the iteration that just completed was idle.
+  auto iterate(const u32* registers, u32 count) -> bool {
+    bool idle = primed && pure && count == this->count;
+    if(idle) idle = memory::compare(state, registers, count * sizeof(u32)) == 0;
+
+    //opcode fetches fall inside of the loop; everything else is polled data
+    polls = 0;
+    for(u32 n : range(reads)) {
+      if(!idle) break;
+      u32 address = read[n];
+      if(address >= head && address < tail + 8) continue;
+      bool found = false;
+      for(u32 p : range(polls)) found |= poll[p].address == address;
+      if(found) continue;
+      if(polls == Polls) { idle = false; break; }
+      poll[polls++] = {address, 0};
+    }
+
+    memory::copy(state, registers, count * sizeof(u32));
+    this->count = count;
+    primed = true;
+    pure = true;
+    length = 0;
+    reads = 0;
+    repeats = idle ? repeats + 1 : 0;
+    return idle;
+  }
+
+  alwaysinline auto reading(u32 address) -> void {
+    if(reads < Reads) read[reads++] = address;
+    else pure = false;
+  }
+
+  alwaysinline auto writing() -> void {
+    pure = false;
+  }
+
+  //returns the duration of the previous iteration, once two idle iterations in a row have been timed.
+  //the scheduler periodically rebases thread clocks, so a clock that went backward is not a duration.
+  auto elapsed(u64 clock) -> u64 {
+    u64 duration = clock >= this->clock ? clock - this->clock : 0;
+    this->clock = clock;
+    return repeats >= 2 ? duration : 0;
+  }
+
+  //records the current value of each polled address: returns false if any cannot be read safely.
+  template<typename F> auto sample(F&& peek) -> bool {
+    for(u32 p : range(polls)) {
+      maybe<u32> data = peek(poll[p].address);
+      if(!data) return false;
+      poll[p].data = *data;
+    }
+    return true;
+  }
+
+  //returns true if no polled address has changed since sample().
+  template<typename F> auto unchanged(F&& peek) -> bool {
+    for(u32 p : range(polls)) {
+      maybe<u32> data = peek(poll[p].address);
+      if(!data || *data != poll[p].data) return false;
+    }
+    return true;
+  }
+
+  struct Poll {
+    u32 address;
+    u32 data;
+  };
+
+  bool enable = false;
+  bool primed = false;
+  bool pure = false;
+  u32 head = ~0;
+  u32 tail = ~0;
+  u32 last = ~0;
+  u32 length = 0;
+  u32 repeats = 0;
+  u32 count = 0;
+  u32 reads = 0;
+  u32 polls = 0;
+  u64 clock = 0;
+  u32 state[Registers];
+  u32 read[Reads];
+  Poll poll[Polls];
+};
+
+}
@@ -1,6 +1,17 @@
 struct Instruction : Tracer {
   DeclareClass(Instruction, "debugger.tracer.instruction")
 
+  //binary trace entries: each instruction entry is followed by the registers that changed since the previous one
+  struct Record {
+    enum class Type : u32 { Instruction, Register, Omitted, Dropped };
+    u64  data;  //address, register value, or number of omitted or dropped entries
+    u32  code;  //instruction opcode or register index
+    Type type;
+  };
+
+  //the ring holds about a second of tracing at full speed for the fastest cores
+  static constexpr u32 Records = 1 << 20;
+
   Instruction(string name = {}, string component = {}) : Tracer(name, component) {
     setMask(_mask);
     setDepth(_depth);
@@ -10,6 +21,7 @@ struct Instruction : Tracer {
   auto addressMask() const -> u32 { return _addressMask; }
   auto mask() const -> bool { return _mask; }
   auto depth() const -> u32 { return _depth; }
+  auto binary() const -> bool { return _binary; }
 
   auto setAddressBits(u32 addressBits, u32 addressMask = 0) -> void {
     _addressBits = addressBits;
@@ -18,14 +30,33 @@ struct Instruction : Tracer {
 
   auto setMask(bool mask) -> void {
     _mask = mask;
-    _masks.reset();
+    _regions.reset();
+    _visits.reset();
+    _region = ~0ull;
+    _visit = 0;
   }
 
   auto setDepth(u32 depth) -> void {
     _depth = depth;
     _history.reset();
-    _history.resize(depth);
-    for(auto& history : _history) history = ~0ull;
+    _history.resize(depth, ~0ull);
+    _historyIndex = 0;
+    _recent.reset();
+    _recent.resize(bit::round(max(1u, depth) * 2), ~0ull);
+  }
+
+  //in binary mode, cores call record() in place of notify(), and the frontend drains entries with read().
+  //the ring buffer is single-producer, single-consumer: it may be read from another thread,
+  //but binary mode must only be toggled while nothing is reading from it.
+  //the ring is only allocated once the first entry is recorded, so tracers of cores that do not
+  //support binary tracing never allocate one.
+  auto setBinary(bool binary) -> void {
+    _ring = nullptr;
+    _records.reset();
+    _registers.reset();
+    _recorded.reset();
+    _dropped = 0;
+    _binary = binary;
   }
 
   auto address(u64 address) -> bool {
@@ -34,22 +65,22 @@ struct Instruction : Tracer {
     address >>= _addressMask;  //clip unneeded alignment bits (to reduce _masks size)
 
     if(_mask) {
-      auto mask = _masks.find(address);
-      if(!mask) mask = _masks.insert(address);
-      if(mask->visit(address)) return false;  //do not trace twice
+      auto offset = region(address, true);
+      auto& visits = _visits[offset + ((address >> 6) & (VisitWords - 1))];
+      const u64 bit = 1ull << (address & 0x3f);
+      if(visits & bit) return false;  //do not trace twice
+      visits |= bit;
     }
 
     if(_depth) {
-      for(auto history : _history) {
-        if(_address == history) {
-          _omitted++;
-          return false;  //do not trace again if recently traced
-        }
-      }
-      for(auto index : range(_depth - 1)) {
-        _history[index] = _history[index + 1];
+      if(recent(_address)) {
+        _omitted++;
+        return false;  //do not trace again if recently traced
       }
-      _history.last() = _address;
+      if(_history[_historyIndex] != ~0ull) forget(_history[_historyIndex]);
+      remember(_address);
+      _history[_historyIndex] = _address;
+      if(++_historyIndex == _depth) _historyIndex = 0;
     }
 
     return true;
@@ -62,8 +93,9 @@ struct Instruction : Tracer {
       address &= ~0ull >> (64 - _addressBits);
       address >>= _addressMask;
 
-      auto mask = _masks.find(address);
-      if(mask) mask->unvisit(address);
+      if(auto offset = region(address, false); offset != ~0u) {
+        _visits[offset + ((address >> 6) & (VisitWords - 1))] &= ~(1ull << (address & 0x3f));
+      }
     }
   }
 
@@ -87,6 +119,32 @@ struct Instruction : Tracer {
     PlatformLog({output.strip(), "\n"});
   }
 
+  auto record(u32 instruction) -> void {
+    if(_omitted) {
+      push({_omitted, 0, Record::Type::Omitted});
+      _omitted = 0;
+    }
+    push({_address, instruction, Record::Type::Instruction});
+  }
+
+  auto record(u32 index, u64 value) -> void {
+    if(_dropped) return;  //all registers are recorded again after the next instruction entry
+    if(index < _registers.size() && _recorded[index] && _registers[index] == value) return;
+    if(index >= _registers.size()) {
+      _registers.resize(index + 1);
+      _recorded.resize(index + 1);
+    }
+    _registers[index] = value;
+    _recorded[index] = true;
+    push({value, index, Record::Type::Register});
+  }
+
+  auto read() -> maybe<Record> {
+    auto records = _ring.load(std::memory_order_acquire);
+    if(!records) return nothing;
+    return records->read();
+  }
+
   auto serialize(string& output, string depth) -> void override {
     Tracer::serialize(output, depth);
     output.append(depth, "  addressBits: ", _addressBits, "\n");
@@ -107,27 +165,88 @@ struct Instruction : Tracer {
   }
 
 protected:
-  struct VisitMask {
-    VisitMask(u64 address) : upper(address >> 6), mask(0) {}
-    auto operator==(const VisitMask& source) const -> bool { return upper == source.upper; }
+  //trace masking keeps one bit per address, in flat bitmaps covering 64K addresses each.
+  //regions are allocated on first use; consecutive lookups almost always hit the same region.
+  static constexpr u32 VisitWords = 65536 / 64;
+
+  struct VisitRegion {
+    VisitRegion(u64 upper, u32 offset = 0) : upper(upper), offset(offset) {}
+    auto operator==(const VisitRegion& source) const -> bool { return upper == source.upper; }
     auto hash() const -> u32 { return upper; }
 
-    auto visit(u64 address) -> bool {
-      const u64 bit = 1ull << (address & 0x3f);
-      if(mask & bit) return true;
-      mask |= bit;
-      return false;
+    u64 upper;
+    u32 offset;  //into _visits
+  };
+
+  //returns the offset of the bitmap for address into _visits, or ~0 if it does not exist and allocate is false
+  auto region(u64 address, bool allocate) -> u32 {
+    if(address >> 16 == _region) return _visit;
+    auto entry = _regions.find(address >> 16);
+    if(!entry) {
+      if(!allocate) return ~0u;
+      entry = _regions.insert({address >> 16, (u32)_visits.size()});
+      _visits.resize(_visits.size() + VisitWords);
     }
+    _region = address >> 16;
+    _visit = entry->offset;
+    return _visit;
+  }
 
-    auto unvisit(u64 address) -> void {
-      const u64 bit = 1ull << (address & 0x3f);
-      mask &= ~bit;
+  //the last _depth traced addresses are kept in a ring buffer, and indexed by an open-addressing hash table
+  //(_recent, with linear probing) so that checking for a recently traced address does not scan the ring.
+  //addresses are unique within the ring, as recently traced addresses are never added again.
+  auto slot(u64 address) const -> u32 {
+    return (address * 0x9e37'79b9'7f4a'7c15ull >> 32) & (_recent.size() - 1);
+  }
+
+  auto recent(u64 address) const -> bool {
+    for(u32 index = slot(address); _recent[index] != ~0ull; index = (index + 1) & (_recent.size() - 1)) {
+      if(_recent[index] == address) return true;
     }
+    return false;
+  }
 
-  private:
-    u64 upper;
-    u64 mask;
-  };
+  auto remember(u64 address) -> void {
+    u32 index = slot(address);
+    while(_recent[index] != ~0ull) index = (index + 1) & (_recent.size() - 1);
+    _recent[index] = address;
+  }
+
+  auto forget(u64 address) -> void {
+    const u32 mask = _recent.size() - 1;
+    u32 index = slot(address);
+    while(_recent[index] != address) index = (index + 1) & mask;
+    //shift later entries of the probe sequence back into the hole, rather than leaving tombstones
+    for(u32 next = (index + 1) & mask; _recent[next] != ~0ull; next = (next + 1) & mask) {
+      if(((next - slot(_recent[next])) & mask) >= ((next - index) & mask)) {
+        _recent[index] = _recent[next];
+        index = next;
+      }
+    }
+    _recent[index] = ~0ull;
+  }
+
+  //entries are dropped rather than waiting on the consumer. recording resumes with the first
+  //instruction entry that fits after a count of the dropped entries, and all of its registers.
+  auto push(const Record& record) -> void {
+    if(!_records) {
+      _records = new queue_spsc<Record[Records]>;
+      _ring.store(_records.data(), std::memory_order_release);
+    }
+    if(_dropped) {
+      //wait for an instruction entry, and room for it as well as the count
+      if(record.type != Record::Type::Instruction || _records->size() > Records - 2) {
+        _dropped++;
+        return;
+      }
+      _records->write({_dropped, 0, Record::Type::Dropped});
+      _dropped = 0;
+    }
+    if(_records->write(record)) return;
+    _dropped++;
+    _registers.reset();
+    _recorded.reset();
+  }
 
   u32  _addressBits = 32;
   u32  _addressMask = 0;
@@ -138,5 +257,16 @@ protected:
   n64 _address = 0;
   n64 _omitted = 0;
   vector<u64> _history;
-  hashset<VisitMask> _masks;
+  u32 _historyIndex = 0;
+  vector<u64> _recent;
+  hashset<VisitRegion> _regions;
+  vector<u64> _visits;
+  u64 _region = ~0ull;  //the most recently used region
+  u32 _visit = 0;       //and its offset into _visits
+  bool _binary = false;
+  unique_pointer<queue_spsc<Record[Records]>> _records;
+  std::atomic<queue_spsc<Record[Records]>*> _ring = nullptr;  //_records, once published to the reader
+  vector<u64> _registers;
+  vector<bool> _recorded;  //whether _registers[index] has been sent since the last drop
+  u64 _dropped = 0;
 };
@@ -158,7 +158,7 @@ auto Screen::detach(Node::Video::Sprite sprite) -> void {
   _sprites.removeByValue(sprite);
 }
 
-auto Screen::colors(u32 colors, function<n64 (n32)> color) -> void {
+auto Screen::colors(u32 colors, inline_function<n64 (n32)> color) -> void {
   lock_guard<recursive_mutex> lock(_mutex);
   _colors = colors;
   _color = color;
@@ -196,6 +196,43 @@ auto Screen::refresh() -> void {
   auto input  = _inputB.data();
   auto output = _output.data();
 
+  //interlacing and interframe blending read back the previous frame from _output.
+  //otherwise, the final pass can be written straight into a buffer owned by the video driver.
+  u32* direct = nullptr;
+  u32 directPitch = 0;
+  if(!_interlace && !_interframeBlending) {
+    bool sideways = _rotation == 90 || _rotation == 270;
+    direct = platform->acquire(shared(), directPitch, sideways ? viewHeight : viewWidth, sideways ? viewWidth : viewHeight);
+    directPitch /= sizeof(u32);
+  }
+
+  if(direct && _rotation == 0) {
+    n32 mask = 1 << 24 | 1 << 16 | 1 << 8 | 1 << 0;
+    for(u32 y : range(viewHeight)) {
+      auto sourceY = _progressive && _progressiveDouble ? (viewY + y) & ~1 : viewY + y;
+      auto source = input + sourceY * pitch;
+      auto target = direct + y * directPitch;
+
+      if(_colorBleed) {
+        for(u32 x : range(viewWidth)) {
+          u32 sourceX = viewX + x;
+          auto a = _palette[source[sourceX]];
+          auto b = _palette[source[sourceX + (sourceX != width - 1)]];
+          *target++ = (a + b - ((a ^ b) & mask)) >> 1;
+        }
+      } else {
+        for(u32 x : range(viewWidth)) {
+          *target++ = _palette[source[viewX + x]];
+        }
+      }
+    }
+
+    refreshSprites(direct, directPitch, viewX, viewY, viewWidth, viewHeight);
+    platform->video(shared(), direct, directPitch * sizeof(u32), viewWidth, viewHeight);
+    memory::fill<u32>(_inputB.data(), width * height, _fillColor);
+    return;
+  }
+
   for(u32 y : range(height)) {
     auto source = input  + y * pitch;
     auto target = output + y * width;
@@ -240,24 +277,29 @@ auto Screen::refresh() -> void {
     }
   }
 
-  for(auto& sprite : _sprites) {
-    if(!sprite->visible()) continue;
-
-    n32 alpha = 255u << 24;
-    for(int y : range(sprite->height())) {
-      s32 pixelY = sprite->y() + y;
-      if(pixelY < 0 || pixelY >= height) continue;
-
-      auto source = sprite->image().data() + y * sprite->width();
-      auto target = &output[pixelY * width];
-      for(s32 x : range(sprite->width())) {
-        s32 pixelX = sprite->x() + x;
-        if(pixelX < 0 || pixelX >= width) continue;
-
-        auto pixel = source[x];
-        if(pixel >> 24) target[pixelX] = alpha | pixel;
+  refreshSprites(output, width, 0, 0, width, height);
+
+  if(direct) {
+    //rotate straight into the driver buffer, visiting only the pixels inside the viewport.
+    //(viewX + x, viewY + y) index the rotated image, so each loop applies the inverse rotation.
+    if(_rotation == 90 || _rotation == 270) swap(viewWidth, viewHeight);
+    for(u32 y : range(viewHeight)) {
+      auto target = direct + y * directPitch;
+      u32 rotateY = viewY + y;
+      if(_rotation == 90) {
+        for(u32 x : range(viewWidth)) *target++ = output[(viewX + x) * width + (width - 1 - rotateY)];
+      }
+      if(_rotation == 180) {
+        for(u32 x : range(viewWidth)) *target++ = output[(height - 1 - rotateY) * width + (width - 1 - (viewX + x))];
+      }
+      if(_rotation == 270) {
+        for(u32 x : range(viewWidth)) *target++ = output[(height - 1 - (viewX + x)) * width + rotateY];
       }
     }
+
+    platform->video(shared(), direct, directPitch * sizeof(u32), viewWidth, viewHeight);
+    memory::fill<u32>(_inputB.data(), width * height, _fillColor);
+    return;
   }
 
   if(_rotation == 90) {
@@ -304,6 +346,29 @@ auto Screen::refresh() -> void {
   memory::fill<u32>(_inputB.data(), width * height, _fillColor);
 }
 
+//draws the visible sprites that overlap the canvas region (x, y, width, height) into output
+auto Screen::refreshSprites(u32* output, u32 pitch, u32 x, u32 y, u32 width, u32 height) -> void {
+  for(auto& sprite : _sprites) {
+    if(!sprite->visible()) continue;
+
+    n32 alpha = 255u << 24;
+    for(s32 spriteY : range(sprite->height())) {
+      s32 pixelY = sprite->y() + spriteY - (s32)y;
+      if(pixelY < 0 || pixelY >= (s32)height) continue;
+
+      auto source = sprite->image().data() + spriteY * sprite->width();
+      auto target = &output[pixelY * pitch];
+      for(s32 spriteX : range(sprite->width())) {
+        s32 pixelX = sprite->x() + spriteX - (s32)x;
+        if(pixelX < 0 || pixelX >= (s32)width) continue;
+
+        auto pixel = source[spriteX];
+        if(pixel >> 24) target[pixelX] = alpha | pixel;
+      }
+    }
+  }
+}
+
 auto Screen::refreshPalette() -> void {
   lock_guard<recursive_mutex> lock(_mutex);
   if(_palette) return;
@@ -53,7 +53,7 @@ struct Screen : Video {
   auto attach(Node::Video::Sprite) -> void;
   auto detach(Node::Video::Sprite) -> void;
 
-  auto colors(u32 colors, function<n64 (n32)> color) -> void;
+  auto colors(u32 colors, inline_function<n64 (n32)> color) -> void;
   auto frame() -> void;
   auto refresh() -> void;
 
@@ -61,6 +61,7 @@ struct Screen : Video {
   auto unserialize(Markup::Node node) -> void override;
 
 private:
+  auto refreshSprites(u32* output, u32 pitch, u32 x, u32 y, u32 width, u32 height) -> void;
   auto refreshPalette() -> void;
 
 protected:
@@ -81,7 +82,7 @@ protected:
   bool _interframeBlending = false;
   u32  _rotation = 0;  //counter-clockwise (90 = left, 270 = right)
 
-  function<n64 (n32)> _color;
+  inline_function<n64 (n32)> _color;
   unique_pointer<u32[]> _inputA;
   unique_pointer<u32[]> _inputB;
   unique_pointer<u32[]> _output;
@@ -17,12 +17,13 @@ struct Platform {
   virtual auto event(Event) -> void {}
   virtual auto log(string_view message) -> void {}
   virtual auto status(string_view message) -> void {}
+  virtual auto acquire(Node::Video::Screen, u32& pitch, u32 width, u32 height) -> u32* { return nullptr; }
   virtual auto video(Node::Video::Screen, const u32* data, u32 pitch, u32 width, u32 height) -> void {}
   virtual auto audio(Node::Audio::Stream) -> void {}
   virtual auto input(Node::Input::Input) -> void {}
 };
 
-extern Platform* platform;
+extern instance_local Platform* platform;
 
 }
 
@@ -44,4 +44,4 @@ private:
   friend class Thread;
 };
 
-extern Scheduler scheduler;
+extern instance_local Scheduler scheduler;
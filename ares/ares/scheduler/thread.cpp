@@ -1,5 +1,5 @@
 inline auto Thread::EntryPoints() -> vector<EntryPoint>& {
-  static vector<EntryPoint> entryPoints;
+  static instance_local vector<EntryPoint> entryPoints;
   return entryPoints;
 }
 
@@ -45,7 +45,7 @@ inline auto Thread::setClock(u64 clock) -> void {
   _clock = clock;
 }
 
-inline auto Thread::create(double frequency, function<void ()> entryPoint) -> void {
+inline auto Thread::create(double frequency, inline_function<void ()> entryPoint) -> void {
   if(!_handle) {
     _handle = co_create(Thread::Size, &Thread::Enter);
   } else {
@@ -58,7 +58,7 @@ inline auto Thread::create(double frequency, function<void ()> entryPoint) -> vo
 }
 
 //returns a thread to its entry point (eg for a reset), without resetting the clock value
-inline auto Thread::restart(function<void()> entryPoint) -> void {
+inline auto Thread::restart(inline_function<void ()> entryPoint) -> void {
   co_derive(_handle, Thread::Size, &Thread::Enter);
   EntryPoints().append({_handle, entryPoint});
 }
@@ -101,19 +101,39 @@ inline auto Thread::serialize(serializer& s) -> void {
   s(_clock);
 
   if(!scheduler._synchronize) {
-    static u8 stack[Thread::Size];
+    static instance_local u8 stack[Thread::Size];
     bool resume = co_active() == _handle;
 
+    //only the saved context at the start of the thread's memory, and the live portion of the
+    //stack at its end, need to be stored. if libco cannot report these, store all of the memory.
+    u32 context = Thread::Size;
+    u32 offset = Thread::Size;
+
     if(s.reading()) {
-      s(stack);
+      s(context);
+      s(offset);
+      offset = min(offset, (u32)Thread::Size);
+      context = min(context, offset);
+      s(array_span<u8>{stack, context});
+      s(array_span<u8>{stack + offset, Thread::Size - offset});
       s(resume);
-      memory::copy(_handle, stack, Thread::Size);
+      memory::copy(_handle, stack, context);
+      memory::copy((u8*)_handle + offset, stack + offset, Thread::Size - offset);
       if(resume) scheduler._resume = _handle;
     }
 
     if(s.writing()) {
-      memory::copy(stack, _handle, Thread::Size);
-      s(stack);
+      unsigned int liveContext, liveOffset;
+      if(co_live(_handle, Thread::Size, &liveContext, &liveOffset)) {
+        context = liveContext;
+        offset = liveOffset;
+      }
+      memory::copy(stack, _handle, context);
+      memory::copy(stack + offset, (u8*)_handle + offset, Thread::Size - offset);
+      s(context);
+      s(offset);
+      s(array_span<u8>{stack, context});
+      s(array_span<u8>{stack + offset, Thread::Size - offset});
       s(resume);
     }
   }
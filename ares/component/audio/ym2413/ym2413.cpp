@@ -69,19 +69,22 @@ auto YM2413::power(bool isVRC7) -> void {
   }
   for(auto& byte : customTone) byte = 0x00;
 
-  if(!sinTable[0] || !expTable[0])
-  for(auto x : range(0x100)) {
-    //10.9 fixed point phases
-    auto y = sin((2 * x + 1) * Math::Pi / 1024.0);   //0x400 units to 2pi radians
-    auto z = -(1 << 8) * log(y) / log(2);            //convert to -6 dB/256 units
-    auto s = (1 << 10) * pow(2, n8(~x) / 256.0);  //0x7fa .. 0x400
+  //the tables are shared by all instances: a static initializer builds them exactly once
+  [[maybe_unused]] static bool tables = [] {
+    for(auto x : range(0x100)) {
+      //10.9 fixed point phases
+      auto y = sin((2 * x + 1) * Math::Pi / 1024.0);   //0x400 units to 2pi radians
+      auto z = -(1 << 8) * log(y) / log(2);            //convert to -6 dB/256 units
+      auto s = (1 << 10) * pow(2, n8(~x) / 256.0);  //0x7fa .. 0x400
 
-    sinTable[0x000 + x] = sinTable[0x1ff - x] = u32(z + 0.5) * 2 + 1;
-    sinTable[0x200 + x] = sinTable[0x3ff - x] = u32(z + 0.5) * 2 + 0;
+      sinTable[0x000 + x] = sinTable[0x1ff - x] = u32(z + 0.5) * 2 + 1;
+      sinTable[0x200 + x] = sinTable[0x3ff - x] = u32(z + 0.5) * 2 + 0;
 
-    expTable[x * 2 + 1] = +u32(s + 0.5);
-    expTable[x * 2 + 0] = ~u32(s + 0.5);
-  }
+      expTable[x * 2 + 1] = +u32(s + 0.5);
+      expTable[x * 2 + 0] = ~u32(s + 0.5);
+    }
+    return true;
+  }();
 
   io = {};
   io.isVRC7 = isVRC7;
@@ -25,6 +25,7 @@ auto ARM7TDMI::power() -> void {
   irq = 0;
   cpsr().f = 1;
   exception(PSR::SVC, 0x00);
+  idleLoop.reset();
 }
 
 }
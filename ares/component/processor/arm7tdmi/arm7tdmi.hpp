@@ -21,6 +21,7 @@ struct ARM7TDMI {
   virtual auto sleep() -> void = 0;
   virtual auto get(u32 mode, n32 address) -> n32 = 0;
   virtual auto set(u32 mode, n32 address, n32 word) -> void = 0;
+  virtual auto idleLoopDetected() -> u32 { return 0; }
 
   //arm7tdmi.cpp
   ARM7TDMI();
@@ -58,6 +59,7 @@ struct ARM7TDMI {
   auto fetch() -> void;
   auto instruction() -> void;
   auto exception(u32 mode, n32 address) -> void;
+  auto idleLoopIterate() -> void;
   auto armInitialize() -> void;
   auto thumbInitialize() -> void;
 
@@ -226,6 +228,8 @@ struct ARM7TDMI {
   b1  carry;
   b1  irq;
 
+  IdleLoop idleLoop;
+
   function<void (n32 opcode)> armInstruction[4096];
   function<void ()> thumbInstruction[65536];
 
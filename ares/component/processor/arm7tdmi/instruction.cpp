@@ -36,6 +36,7 @@ auto ARM7TDMI::instruction() -> void {
     return;
   }
 
+  if(idleLoop && idleLoop.instruction(pipeline.execute.address)) idleLoopIterate();
   opcode = pipeline.execute.instruction;
   if(!pipeline.execute.thumb) {
     if(!TST(opcode.bit(28,31))) return;
@@ -57,6 +58,13 @@ auto ARM7TDMI::exception(u32 mode, n32 address) -> void {
   r(15) = address;
 }
 
+auto ARM7TDMI::idleLoopIterate() -> void {
+  u32 registers[17];
+  for(u32 n : range(16)) registers[n] = r(n);
+  registers[16] = cpsr() | pipeline.nonsequential << 8;
+  if(idleLoop.iterate(registers, 17)) idleLoopDetected();
+}
+
 auto ARM7TDMI::armInitialize() -> void {
   #define bind(id, name, ...) { \
     u32 index = (id & 0x0ff00000) >> 16 | (id & 0x000000f0) >> 4; \
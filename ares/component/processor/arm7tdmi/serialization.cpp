@@ -3,6 +3,7 @@ auto ARM7TDMI::serialize(serializer& s) -> void {
   s(pipeline);
   s(carry);
   s(irq);
+  idleLoop.reset();
 }
 
 auto ARM7TDMI::Processor::serialize(serializer& s) -> void {
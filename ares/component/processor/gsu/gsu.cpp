@@ -11,6 +11,7 @@ namespace ares {
 #include "instructions.cpp"
 #include "serialization.cpp"
 #include "disassembler.cpp"
+#include "recompiler.cpp"
 
 auto GSU::power() -> void {
   for(auto& r : regs.r) {
@@ -34,6 +35,12 @@ auto GSU::power() -> void {
   regs.pipeline = 0x01;  //nop
   regs.ramaddr  = 0x0000;
   regs.reset();
+
+  if constexpr(Accuracy::Recompiler) {
+    auto buffer = ares::Memory::FixedAllocator::get().tryAcquire(16_MiB);
+    recompiler.allocator.resize(16_MiB, bump_allocator::executable | bump_allocator::zero_fill, buffer);
+    recompiler.reset();
+  }
 }
 
 }
@@ -1,17 +1,23 @@
 #pragma once
 
+#include <nall/recompiler/generic/generic.hpp>
+
 namespace ares {
 
 struct GSU {
   #include "registers.hpp"
 
   virtual auto step(u32 clocks) -> void = 0;
+  virtual auto synchronizing() const -> bool = 0;
+  virtual auto budget() const -> u32 = 0;
 
   virtual auto stop() -> void = 0;
   virtual auto color(n8 source) -> n8 = 0;
   virtual auto plot(n8 x, n8 y) -> void = 0;
   virtual auto rpix(n8 x, n8 y) -> n8 = 0;
 
+  virtual auto readOpcode(n16 address) -> n8 = 0;
+  virtual auto peekOpcode(n16 address) -> n8 = 0;
   virtual auto pipe() -> n8 = 0;
   virtual auto syncROMBuffer() -> void = 0;
   virtual auto readROMBuffer() -> n8 = 0;
@@ -83,6 +89,99 @@ struct GSU {
   auto disassembleALT1(char* output) -> void;
   auto disassembleALT2(char* output) -> void;
   auto disassembleALT3(char* output) -> void;
+
+  //recompiler.cpp
+  auto fetchOpcode(u32 address) -> void;
+  auto interpret(u32 opcode) -> void;
+
+  struct Recompiler : recompiler::generic {
+    GSU& self;
+    Recompiler(GSU& self) : generic(allocator), self(self) {}
+
+    struct Block {
+      auto execute(GSU& self) -> void {
+        ((void (*)(GSU*, Registers*))code)(&self, &self.regs);
+      }
+
+      u8* code;
+      Block* next;  //other blocks at the same address
+      n16 cbr;
+      n8 opcode;    //pipeline contents on entry
+      n8 mode;      //clsr, cfgr.ms0, scmr.md and scmr.ht on entry
+    };
+
+    struct Pool {
+      Block* blocks[1 << 8];
+    };
+
+    enum : u32 {
+      Yield   = 1 << 0,  //the S-CPU must run, or may have changed GSU state
+      Invalid = 1 << 1,  //an opcode did not match the one the block was compiled for
+    };
+
+    auto reset() -> void {
+      cycles = 0;
+      status = 0;
+      for(u32 index : range(1 << 15)) pools[index] = nullptr;
+    }
+
+    auto yield() -> void {
+      status |= Yield;
+    }
+
+    auto flush() -> void {
+      if(!cycles) return;
+      u32 clocks = cycles;
+      cycles = 0;
+      self.step(clocks);
+      budget = self.budget();
+    }
+
+    auto execute() -> bool;
+    auto pool(u32 address) -> Pool*;
+    auto block(u32 address) -> Block*;
+    auto discard(u32 address, Block* block) -> void;
+    auto emit(u32 address) -> Block*;
+    auto emitInstruction(u8 opcode, u16 pc, maybe<u8> next) -> bool;
+    auto emitFetch(u16 address, bool operand) -> void;
+    auto emitGuard(maybe<u8> next) -> void;
+    auto emitInterpret(u8 opcode) -> void;
+    auto emitBoundary(u16 address) -> void;
+    auto emitLoop() -> void;
+    auto emitROMBuffer() -> void;
+    auto emitReset() -> void;
+    auto emitSZ(reg flags, reg value, reg temp, u32 sign = 0x8000) -> void;
+    auto emitFlags(reg flags, reg temp, u32 mask) -> void;
+    template<typename T> auto emitWrite(u32 n, T value) -> void;
+
+    static auto operands(u8 opcode) -> u32;
+
+    //emitter state
+    u32 start;
+    u8 entryOpcode;
+    sljit_label* entry;
+    n16 cbr;
+    bool clsr;
+    bool ms0;
+    u32 md;
+    u32 ht;
+    u32 alt;
+    bool with;
+    u32 from;
+    u32 to;
+    u32 written;
+    bool called;
+
+    u32 cycles = 0;  //clocks that recompiled code has not yet passed to step()
+    u32 budget = 0;  //clocks that may pass before the S-CPU must catch up
+    u32 status = 0;
+    u8* ram = nullptr;  //game pak RAM, for RPIX
+    u32 ramMask = 0;
+    bump_allocator allocator;
+    Pool* pools[1 << 15];
+  } recompiler{*this};
+
+  #include "accuracy.hpp"
 };
 
 }
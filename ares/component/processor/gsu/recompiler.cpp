@@ -0,0 +1,1085 @@
+//the recompiler translates runs of instructions into blocks, which are specialized on the
+//prefix state (ALT1/ALT2, B, Sreg, Dreg) that each instruction will see, and on CBR, CLSR
+//and CFGR.MS0 at entry. opcodes are fetched at runtime exactly as the interpreter would,
+//and are compared against the opcodes the block was compiled for: a mismatch, such as from
+//code in game pak RAM or the instruction cache having been rewritten, discards the block.
+//clocks are counted by the block and passed to step() before anything that can observe them.
+//a block also exits once it has counted more clocks than remained before the S-CPU had to run,
+//so that the GSU runs no further ahead of the S-CPU than the interpreter would.
+
+#define Field(f)    mem(sreg(1), (u8*)&self.f - (u8*)&self.regs)
+#define R(n)        Field(regs.r[n])
+#define Modified(n) Field(regs.r[n].modified)
+#define SFR         Field(regs.sfr.data)
+#define Pipeline    Field(regs.pipeline)
+#define Sreg        Field(regs.sreg)
+#define Dreg        Field(regs.dreg)
+#define Romcl       Field(regs.romcl)
+#define Romdr       Field(regs.romdr)
+#define Colr        Field(regs.colr)
+#define Cycles      Field(recompiler.cycles)
+#define Budget      Field(recompiler.budget)
+#define Status      Field(recompiler.status)
+
+#define FlagZ    0x0002
+#define FlagCY   0x0004
+#define FlagS    0x0008
+#define FlagOV   0x0010
+#define FlagR    0x0040
+#define FlagALT1 0x0100
+#define FlagALT2 0x0200
+#define FlagB    0x1000
+
+auto GSU::fetchOpcode(u32 address) -> void {
+  recompiler.flush();
+  regs.pipeline = readOpcode(address);
+  regs.r[15].modified = false;
+  if(synchronizing()) recompiler.yield();
+}
+
+auto GSU::interpret(u32 opcode) -> void {
+  recompiler.flush();
+  instruction(opcode);
+  if(synchronizing()) recompiler.yield();
+}
+
+//runs the block for the current instruction, up to the epilogue of its final instruction.
+//returns false when the interpreter must run the current instruction instead.
+auto GSU::Recompiler::execute() -> bool {
+  //blocks may only be entered between instructions
+  if(self.regs.sfr.data & (FlagALT1 | FlagALT2 | FlagB)) return false;
+  if(self.regs.sreg || self.regs.dreg) return false;
+
+  u32 address = self.regs.pbr << 16 | self.regs.r[15];
+  auto block = this->block(address);
+  status = 0;
+  budget = self.budget();
+  block->execute(self);
+  if(status & Invalid) discard(address, block);
+  flush();
+  return true;
+}
+
+auto GSU::Recompiler::pool(u32 address) -> Pool* {
+  auto& pool = pools[address >> 8 & 0x7fff];
+  if(!pool) pool = (Pool*)allocator.acquire(sizeof(Pool));
+  return pool;
+}
+
+auto GSU::Recompiler::block(u32 address) -> Block* {
+  n8 opcode = self.regs.pipeline;
+  n16 cbr = self.regs.cbr;
+  n8 mode = self.regs.clsr << 0 | self.regs.cfgr.ms0 << 1 | self.regs.scmr.md << 2 | self.regs.scmr.ht << 4;
+  for(auto block = pool(address)->blocks[address & 0xff]; block; block = block->next) {
+    if(block->opcode == opcode && block->cbr == cbr && block->mode == mode) return block;
+  }
+
+  auto block = emit(address);
+  block->opcode = opcode;
+  block->cbr = cbr;
+  block->mode = mode;
+  block->next = pool(address)->blocks[address & 0xff];
+  pool(address)->blocks[address & 0xff] = block;
+  memory::jitprotect(true);
+  return block;
+}
+
+auto GSU::Recompiler::discard(u32 address, Block* block) -> void {
+  memory::jitprotect(false);
+  for(auto link = &pool(address)->blocks[address & 0xff]; *link; link = &(*link)->next) {
+    if(*link == block) {
+      *link = block->next;
+      break;
+    }
+  }
+  memory::jitprotect(true);
+}
+
+auto GSU::Recompiler::operands(u8 opcode) -> u32 {
+  if(opcode >= 0x05 && opcode <= 0x0f) return 1;  //branches
+  if(opcode >= 0xa0 && opcode <= 0xaf) return 1;  //ibt, lms, sms
+  if(opcode >= 0xf0) return 2;                    //iwt, lm, sm
+  return 0;
+}
+
+auto GSU::Recompiler::emit(u32 address) -> Block* {
+  if(unlikely(allocator.available() < 1_MiB)) {
+    print("GSU allocator flush\n");
+    memory::jitprotect(false);
+    allocator.release(bump_allocator::zero_fill);
+    memory::jitprotect(true);
+    reset();
+  }
+
+  auto block = (Block*)allocator.acquire(sizeof(Block));
+  beginFunction(2);
+
+  start = address;
+  entryOpcode = self.regs.pipeline;
+  cbr = self.regs.cbr;
+  clsr = self.regs.clsr;
+  ms0 = self.regs.cfgr.ms0;
+  md = self.regs.scmr.md;
+  ht = self.regs.scmr.ht;
+  alt = 0;
+  with = 0;
+  from = 0;
+  to = 0;
+
+  //peekpipe() clears this flag before the first instruction can observe it
+  mov32_u8(Modified(15), imm(0));
+  entry = sljit_emit_label(compiler);
+
+  n8 opcode = entryOpcode;
+  n16 pc = address;
+  for(u32 count = 0;; count++) {
+    u32 size = operands(opcode);
+    bool last = count == 63 || pc + size + 1 > 0xffff;  //block boundary
+    n8 next = self.peekOpcode(pc + size);
+    maybe<u8> guard;
+    if(!last) guard = (u8)next;
+    written = 0;
+    called = 0;
+    if(emitInstruction(opcode, pc, guard)) break;
+    if(written >> 15 & 1) break;  //jumped
+    if(last) break;
+    emitBoundary(pc + size + 1);
+    opcode = next;
+    pc += size + 1;
+  }
+  jumpEpilog();
+
+  memory::jitprotect(false);
+  block->code = endFunction();
+
+  return block;
+}
+
+//completes an instruction the way SuperFX::main() does, unless the block must exit:
+//then main() completes it instead.
+auto GSU::Recompiler::emitBoundary(u16 address) -> void {
+  sljit_set_label(cmp32_jump(Status, imm(0), flag_ne), epilogue);
+  mov32(reg(0), Cycles);
+  sljit_set_label(cmp32_jump(reg(0), Budget, flag_ugt), epilogue);
+  if(written >> 14 & 1 || called) emitROMBuffer();
+  mov32(R(15), imm(address));  //also clears r15.modified
+}
+
+//peekpipe() and pipe()
+auto GSU::Recompiler::emitFetch(u16 address, bool operand) -> void {
+  if(operand) mov32_u16(R(15), imm(address));
+  n16 offset = address - cbr;
+  if(offset < 512) {
+    mov32_u8(reg(0), Field(cache.valid[offset >> 4]));
+    auto miss = cmp32_jump(reg(0), imm(0), flag_eq);
+    add32(Cycles, Cycles, imm(clsr ? 1 : 2));
+    mov32_u8(reg(0), Field(cache.buffer[offset]));
+    mov32_u8(Pipeline, reg(0));
+    auto hit = jump();
+    setLabel(miss);
+    mov32(reg(1), imm(address));
+    call(&GSU::fetchOpcode);
+    setLabel(hit);
+  } else {
+    mov32(reg(1), imm(address));
+    call(&GSU::fetchOpcode);
+  }
+}
+
+//checks that the next opcode fetched is the one compiled after this instruction
+auto GSU::Recompiler::emitGuard(maybe<u8> next) -> void {
+  if(!next) return;
+  mov32_u8(reg(0), Pipeline);
+  auto match = cmp32_jump(reg(0), imm(*next), flag_eq);
+  or32(Status, Status, imm(Invalid));
+  setLabel(match);
+}
+
+//runs the instruction in the interpreter, once its opcode has been fetched
+auto GSU::Recompiler::emitInterpret(u8 opcode) -> void {
+  mov32(reg(1), imm(opcode));
+  call(&GSU::interpret);
+  called = 1;
+  alt = 0;
+  with = 0;
+  from = 0;
+  to = 0;
+
+  //the instruction may have jumped, or the S-CPU may have written r15
+  mov32_u8(reg(0), Modified(15));
+  sljit_set_label(cmp32_jump(reg(0), imm(0), flag_ne), epilogue);
+}
+
+//returns to the start of the block after a jump to it, so that loops run without leaving
+//recompiled code. expects the jump target in sreg(2), and r15 to already hold it.
+auto GSU::Recompiler::emitLoop() -> void {
+  if(alt || with || from || to) return jumpEpilog();
+  auto target = cmp32_jump(sreg(2), imm(start & 0xffff), flag_ne);
+  mov32_u8(reg(0), Pipeline);
+  auto opcode = cmp32_jump(reg(0), imm(entryOpcode), flag_ne);
+  auto exit = cmp32_jump(Status, imm(0), flag_ne);
+  mov32(reg(0), Cycles);
+  auto clocks = cmp32_jump(reg(0), Budget, flag_ugt);
+  mov32_u8(Modified(15), imm(0));
+  sljit_set_label(jump(), entry);
+  sljit_set_label(target, epilogue);
+  sljit_set_label(opcode, epilogue);
+  sljit_set_label(exit, epilogue);
+  sljit_set_label(clocks, epilogue);
+}
+
+//SuperFX::updateROMBuffer()
+auto GSU::Recompiler::emitROMBuffer() -> void {
+  mov32_u8(reg(0), Modified(14));
+  auto skip = cmp32_jump(reg(0), imm(0), flag_eq);
+  mov32_u8(Modified(14), imm(0));
+  //clocks not yet passed to step() were spent before r14 changed, and must not count toward the reload
+  add32(reg(0), Cycles, imm(clsr ? 5 : 6));
+  mov32(Romcl, reg(0));
+  mov32_u16(reg(0), SFR);
+  or32(reg(0), reg(0), imm(FlagR));
+  mov32_u16(SFR, reg(0));
+  setLabel(skip);
+}
+
+//Registers::reset()
+auto GSU::Recompiler::emitReset() -> void {
+  if(alt || with) {
+    mov32_u16(reg(3), SFR);
+    and32(reg(3), reg(3), imm(~(FlagALT1 | FlagALT2 | FlagB) & 0xffff));
+    mov32_u16(SFR, reg(3));
+  }
+  if(from) mov32(Sreg, imm(0));
+  if(to) mov32(Dreg, imm(0));
+  alt = 0;
+  with = 0;
+  from = 0;
+  to = 0;
+}
+
+//accumulates the sign and zero flags of a 16-bit value
+auto GSU::Recompiler::emitSZ(reg flags, reg value, reg temp, u32 sign) -> void {
+  lshr32(temp, value, imm(sign == 0x8000 ? 12 : 4));
+  and32(temp, temp, imm(FlagS));
+  or32(flags, flags, temp);
+  cmp32(value, imm(0), set_z);
+  mov32_f(temp, flag_z);
+  shl32(temp, temp, imm(1));
+  or32(flags, flags, temp);
+}
+
+//replaces the flags in mask with those accumulated
+auto GSU::Recompiler::emitFlags(reg flags, reg temp, u32 mask) -> void {
+  mov32_u16(temp, SFR);
+  and32(temp, temp, imm(~mask & 0xffff));
+  or32(temp, temp, flags);
+  mov32_u16(SFR, temp);
+}
+
+//Register::assign(), for a value that is already 16-bit
+template<typename T>
+auto GSU::Recompiler::emitWrite(u32 n, T value) -> void {
+  or32(reg(3), value, imm(0x10000));
+  mov32(R(n), reg(3));  //data and modified
+  written |= 1 << n;
+}
+
+//returns true if the block must end after this instruction
+auto GSU::Recompiler::emitInstruction(u8 opcode, u16 pc, maybe<u8> next) -> bool {
+  u32 n = opcode & 15;
+  bool alt1 = alt >> 0 & 1;
+  bool alt2 = alt >> 1 & 1;
+  auto sr = R(from);
+  auto dr = to;
+
+  //peekpipe(), except for the operand fetches of inline instructions
+  emitFetch(pc, false);
+  if(!operands(opcode)) emitGuard(next);
+
+  //instructions that take a register number are decoded by their first opcode
+  u8 base = opcode;
+  if(opcode >= 0x10 && opcode <= 0x2f) base = opcode & 0xf0;
+  if(opcode >= 0x30 && opcode <= 0x3b) base = 0x30;
+  if(opcode >= 0x40 && opcode <= 0x4b) base = 0x40;
+  if(opcode >= 0x50 && opcode <= 0x6f) base = opcode & 0xf0;
+  if(opcode >= 0x71 && opcode <= 0x7f) base = 0x71;
+  if(opcode >= 0x80 && opcode <= 0x8f) base = 0x80;
+  if(opcode >= 0x91 && opcode <= 0x94) base = 0x91;
+  if(opcode >= 0x98 && opcode <= 0x9d) base = 0x98;
+  if(opcode >= 0xa0 && opcode <= 0xbf) base = opcode & 0xf0;
+  if(opcode >= 0xc1 && opcode <= 0xcf) base = 0xc1;
+  if(opcode >= 0xd0 && opcode <= 0xde) base = 0xd0;
+  if(opcode >= 0xe0 && opcode <= 0xee) base = 0xe0;
+  if(opcode >= 0xf0) base = 0xf0;
+
+  switch(base) {
+
+  //stop
+  case 0x00: {
+    emitInterpret(opcode);
+    return 1;
+  }
+
+  //nop
+  case 0x01: {
+    emitReset();
+    return 0;
+  }
+
+  //cache
+  case 0x02: {
+    emitInterpret(opcode);
+    return 1;  //cbr may change
+  }
+
+  //lsr
+  case 0x03: {
+    mov32_u16(reg(0), sr);
+    and32(reg(1), reg(0), imm(1));
+    shl32(reg(1), reg(1), imm(2));  //cy
+    lshr32(reg(0), reg(0), imm(1));
+    emitSZ(reg(1), reg(0), reg(2));
+    emitFlags(reg(1), reg(2), FlagS | FlagZ | FlagCY);
+    emitWrite(dr, reg(0));
+    emitReset();
+    return 0;
+  }
+
+  //rol
+  case 0x04: {
+    mov32_u16(reg(0), sr);
+    mov32_u16(reg(2), SFR);
+    lshr32(reg(2), reg(2), imm(2));
+    and32(reg(2), reg(2), imm(1));
+    lshr32(reg(1), reg(0), imm(13));
+    and32(reg(1), reg(1), imm(FlagCY));
+    shl32(reg(0), reg(0), imm(1));
+    or32(reg(0), reg(0), reg(2));
+    and32(reg(0), reg(0), imm(0xffff));
+    emitSZ(reg(1), reg(0), reg(2));
+    emitFlags(reg(1), reg(2), FlagS | FlagZ | FlagCY);
+    emitWrite(dr, reg(0));
+    emitReset();
+    return 0;
+  }
+
+  //bra, blt, bge, bne, beq, bpl, bmi, bcc, bcs, bvc, bvs
+  case 0x05: case 0x06: case 0x07: case 0x08: case 0x09: case 0x0a:
+  case 0x0b: case 0x0c: case 0x0d: case 0x0e: case 0x0f: {
+    //the target, with bit 16 set if the branch is not taken
+    mov32_s8(reg(0), Pipeline);
+    add32(reg(0), reg(0), imm(pc + 1));
+    and32(sreg(2), reg(0), imm(0xffff));
+    if(opcode != 0x05) {
+      u32 flag = 0;
+      bool take = 0;
+      switch(opcode) {
+      case 0x06: flag = 3; take = 0; break;  //s ^ ov
+      case 0x07: flag = 3; take = 1; break;  //s ^ ov
+      case 0x08: flag = 1; take = 0; break;  //z
+      case 0x09: flag = 1; take = 1; break;  //z
+      case 0x0a: flag = 3; take = 0; break;  //s
+      case 0x0b: flag = 3; take = 1; break;  //s
+      case 0x0c: flag = 2; take = 0; break;  //cy
+      case 0x0d: flag = 2; take = 1; break;  //cy
+      case 0x0e: flag = 4; take = 0; break;  //ov
+      case 0x0f: flag = 4; take = 1; break;  //ov
+      }
+      mov32_u16(reg(0), SFR);
+      if(opcode <= 0x07) {
+        lshr32(reg(1), reg(0), imm(1));
+        xor32(reg(0), reg(0), reg(1));
+      }
+      lshr32(reg(0), reg(0), imm(flag));
+      and32(reg(0), reg(0), imm(1));
+      if(take) xor32(reg(0), reg(0), imm(1));
+      shl32(reg(0), reg(0), imm(16));
+      or32(sreg(2), sreg(2), reg(0));
+    }
+    emitFetch(pc + 1, true);
+    emitGuard(next);
+    sljit_jump* skip = nullptr;
+    if(opcode != 0x05) {
+      test32(sreg(2), imm(0x10000), set_z);
+      skip = jump(flag_nz);
+    }
+    or32(reg(0), sreg(2), imm(0x10000));
+    mov32(R(15), reg(0));
+    emitLoop();
+    if(!skip) return 1;
+    setLabel(skip);
+    return 0;
+  }
+
+  //to rN
+  //move rN
+  case 0x10: {
+    if(!with) {
+      mov32(Dreg, imm(n));
+      to = n;
+      return 0;
+    }
+    mov32_u16(reg(0), sr);
+    emitWrite(n, reg(0));
+    emitReset();
+    return 0;
+  }
+
+  //with rN
+  case 0x20: {
+    mov32(Sreg, imm(n));
+    mov32(Dreg, imm(n));
+    mov32_u16(reg(0), SFR);
+    or32(reg(0), reg(0), imm(FlagB));
+    mov32_u16(SFR, reg(0));
+    from = n;
+    to = n;
+    with = 1;
+    return 0;
+  }
+
+  //stw (rN), stb (rN)
+  case 0x30: {
+    emitInterpret(opcode);
+    return 0;
+  }
+
+  //loop
+  case 0x3c: {
+    mov32_u16(reg(0), R(12));
+    sub32(reg(0), reg(0), imm(1));
+    and32(reg(0), reg(0), imm(0xffff));
+    emitWrite(12, reg(0));
+    mov32(reg(1), imm(0));
+    emitSZ(reg(1), reg(0), reg(2));
+    emitFlags(reg(1), reg(2), FlagS | FlagZ);
+    emitReset();
+    auto skip = cmp32_jump(reg(0), imm(0), flag_eq);
+    mov32_u16(sreg(2), R(13));
+    or32(reg(0), sreg(2), imm(0x10000));
+    mov32(R(15), reg(0));
+    emitLoop();
+    setLabel(skip);
+    return 0;
+  }
+
+  //alt1, alt2, alt3
+  case 0x3d: case 0x3e: case 0x3f: {
+    u32 mode = opcode - 0x3c;
+    mov32_u16(reg(0), SFR);
+    and32(reg(0), reg(0), imm(~FlagB & 0xffff));
+    or32(reg(0), reg(0), imm(mode << 8));
+    mov32_u16(SFR, reg(0));
+    alt |= mode;
+    with = 0;
+    return 0;
+  }
+
+  //ldw (rN), ldb (rN)
+  case 0x40: {
+    emitInterpret(opcode);
+    return 0;
+  }
+
+  //plot
+  //rpix
+  case 0x4c: {
+    if(alt1) {
+      if(!ram) {
+        emitInterpret(opcode);
+        return 0;
+      }
+
+      //SuperFX::rpix(), when neither pixel cache needs flushing and game pak RAM is available
+      mov32_u8(reg(0), Field(pixelcache[0].bitpend));
+      mov32_u8(reg(1), Field(pixelcache[1].bitpend));
+      or32(reg(0), reg(0), reg(1));
+      auto pending = cmp32_jump(reg(0), imm(0), flag_ne);
+      mov32(reg(0), Field(regs.ramcl));
+      auto buffered = cmp32_jump(reg(0), imm(0), flag_ne);
+      mov32_u8(reg(0), Field(regs.scmr.ran));
+      auto released = cmp32_jump(reg(0), imm(0), flag_eq);
+
+      //character number
+      mov32_u8(reg(1), R(1));
+      mov32_u8(reg(2), R(2));
+      sljit_jump* character = nullptr;
+      if(ht != 3) {
+        mov32_u8(reg(0), Field(regs.por.obj));
+        auto object = cmp32_jump(reg(0), imm(0), flag_ne);
+        and32(reg(3), reg(2), imm(0xf8));
+        lshr32(reg(0), reg(3), imm(3));
+        and32(reg(3), reg(1), imm(0xf8));
+        shl32(reg(3), reg(3), imm(1));
+        add32(reg(0), reg(0), reg(3));
+        lshr32(reg(3), reg(3), imm(1));
+        if(ht == 1) lshr32(reg(3), reg(3), imm(1));
+        if(ht != 0) add32(reg(0), reg(0), reg(3));
+        character = jump();
+        setLabel(object);
+      }
+      and32(reg(3), reg(2), imm(0x80));
+      shl32(reg(0), reg(3), imm(2));
+      and32(reg(3), reg(1), imm(0x80));
+      shl32(reg(3), reg(3), imm(1));
+      add32(reg(0), reg(0), reg(3));
+      and32(reg(3), reg(2), imm(0x78));
+      shl32(reg(3), reg(3), imm(1));
+      add32(reg(0), reg(0), reg(3));
+      and32(reg(3), reg(1), imm(0x78));
+      lshr32(reg(3), reg(3), imm(3));
+      add32(reg(0), reg(0), reg(3));
+      if(character) setLabel(character);
+
+      //offset into $70-71:0000-ffff of the first bitplane
+      u32 bpp = 2 << (md - (md >> 1));
+      shl32(reg(0), reg(0), imm(4 + md - (md >> 1)));  //cn * (bpp << 3)
+      mov32_u8(reg(3), Field(regs.scbr));
+      shl32(reg(3), reg(3), imm(10));
+      add32(reg(0), reg(0), reg(3));
+      and32(reg(2), reg(2), imm(7));
+      shl32(reg(2), reg(2), imm(1));
+      add32(reg(0), reg(0), reg(2));
+      auto outside = cmp32_jump(reg(0), imm(0x20000 - 0x31), flag_uge);
+
+      and32(reg(1), reg(1), imm(7));
+      xor32(reg(1), reg(1), imm(7));
+      mov32(reg(2), imm(0));
+      for(u32 n : range(bpp)) {
+        u32 byte = ((n >> 1) << 4) + (n & 1);
+        add32(reg(3), reg(0), imm(byte));
+        and32(reg(3), reg(3), imm(ramMask));
+        mov64_u32(reg(3), reg(3));
+        add64(reg(3), reg(3), imm((sljit_sw)ram));
+        mov32_u8(reg(3), mem(reg(3), 0));
+        lshr32(reg(3), reg(3), reg(1));
+        and32(reg(3), reg(3), imm(1));
+        if(n) shl32(reg(3), reg(3), imm(n));
+        or32(reg(2), reg(2), reg(3));
+      }
+      add32(Cycles, Cycles, imm(bpp * (clsr ? 5 : 6)));
+
+      mov32(reg(1), imm(0));
+      emitSZ(reg(1), reg(2), reg(3));
+      emitFlags(reg(1), reg(3), FlagS | FlagZ);
+      emitWrite(dr, reg(2));
+      emitReset();
+      auto read = jump();
+
+      setLabel(pending);
+      setLabel(buffered);
+      setLabel(released);
+      setLabel(outside);
+      emitInterpret(opcode);
+      setLabel(read);
+      return 0;
+    }
+
+    //SuperFX::plot(), when the pixel lands in the primary pixel cache without filling it
+    mov32_u8(reg(0), Colr);
+    mov32_u8(reg(1), Field(regs.por.transparent));
+    auto opaque = cmp32_jump(reg(1), imm(0), flag_ne);
+    mov32(reg(1), Field(regs.scmr.md));
+    auto nibble = cmp32_jump(reg(1), imm(3), flag_ne);
+    mov32_u8(reg(1), Field(regs.por.freezehigh));
+    auto freeze = cmp32_jump(reg(1), imm(0), flag_ne);
+    auto transparent = cmp32_jump(reg(0), imm(0), flag_eq);
+    auto visible = jump();
+    setLabel(nibble);
+    setLabel(freeze);
+    test32(reg(0), imm(0x0f), set_z);
+    auto transparentNibble = jump(flag_z);
+    setLabel(opaque);
+    setLabel(visible);
+
+    mov32_u8(reg(1), Field(regs.por.dither));
+    auto undithered = cmp32_jump(reg(1), imm(0), flag_eq);
+    mov32(reg(1), Field(regs.scmr.md));
+    auto dither = cmp32_jump(reg(1), imm(3), flag_ne);
+    setLabel(undithered);
+
+    mov32_u8(reg(1), R(1));
+    mov32_u8(reg(2), R(2));
+    shl32(reg(2), reg(2), imm(5));
+    lshr32(reg(3), reg(1), imm(3));
+    add32(reg(2), reg(2), reg(3));
+    mov32_u16(reg(3), Field(pixelcache[0].offset));
+    auto uncached = cmp32_jump(reg(2), reg(3), flag_ne);
+    and32(reg(1), reg(1), imm(7));
+    xor32(reg(1), reg(1), imm(7));
+    mov32(reg(2), imm(1));
+    shl32(reg(2), reg(2), reg(1));
+    mov32_u8(reg(3), Field(pixelcache[0].bitpend));
+    or32(reg(3), reg(3), reg(2));
+    auto full = cmp32_jump(reg(3), imm(0xff), flag_eq);
+    mov32_u8(Field(pixelcache[0].bitpend), reg(3));
+    mov64_u32(reg(1), reg(1));
+    add64(reg(1), reg(1), sreg(1));
+    op_base data{SLJIT_MEM1(reg(1).fst), (u8*)&self.pixelcache[0].data[0] - (u8*)&self.regs};
+    mov32_u8(data, reg(0));
+    auto plotted = jump();
+
+    setLabel(transparent);
+    setLabel(transparentNibble);
+    setLabel(plotted);
+    mov32_u16(reg(0), R(1));
+    add32(reg(0), reg(0), imm(1));
+    and32(reg(0), reg(0), imm(0xffff));
+    emitWrite(1, reg(0));
+    emitReset();
+    auto incremented = jump();
+
+    setLabel(dither);
+    setLabel(uncached);
+    setLabel(full);
+    emitInterpret(opcode);
+    setLabel(incremented);
+    return 0;
+  }
+
+  //swap
+  case 0x4d: {
+    mov32_u16(reg(0), sr);
+    lshr32(reg(1), reg(0), imm(8));
+    shl32(reg(0), reg(0), imm(8));
+    or32(reg(0), reg(0), reg(1));
+    and32(reg(0), reg(0), imm(0xffff));
+    mov32(reg(1), imm(0));
+    emitSZ(reg(1), reg(0), reg(2));
+    emitFlags(reg(1), reg(2), FlagS | FlagZ);
+    emitWrite(dr, reg(0));
+    emitReset();
+    return 0;
+  }
+
+  //color
+  //cmode
+  case 0x4e: {
+    emitInterpret(opcode);
+    return 0;
+  }
+
+  //not
+  case 0x4f: {
+    mov32_u16(reg(0), sr);
+    xor32(reg(0), reg(0), imm(0xffff));
+    mov32(reg(1), imm(0));
+    emitSZ(reg(1), reg(0), reg(2));
+    emitFlags(reg(1), reg(2), FlagS | FlagZ);
+    emitWrite(dr, reg(0));
+    emitReset();
+    return 0;
+  }
+
+  //add rN, adc rN, add #N, adc #N
+  case 0x50: {
+    mov32_u16(reg(0), sr);
+    if(alt2) mov32(reg(1), imm(n));
+    else mov32_u16(reg(1), R(n));
+    add32(reg(2), reg(0), reg(1));
+    if(alt1) {
+      mov32_u16(reg(3), SFR);
+      lshr32(reg(3), reg(3), imm(2));
+      and32(reg(3), reg(3), imm(1));
+      add32(reg(2), reg(2), reg(3));
+    }
+    xor32(reg(3), reg(0), reg(1));
+    xor32(reg(3), reg(3), imm(0x8000));
+    xor32(reg(0), reg(1), reg(2));
+    and32(reg(3), reg(3), reg(0));
+    and32(reg(3), reg(3), imm(0x8000));
+    lshr32(reg(3), reg(3), imm(11));  //ov
+    lshr32(reg(0), reg(2), imm(14));
+    and32(reg(0), reg(0), imm(FlagCY));
+    or32(reg(3), reg(3), reg(0));
+    and32(reg(2), reg(2), imm(0xffff));
+    emitSZ(reg(3), reg(2), reg(0));
+    emitFlags(reg(3), reg(0), FlagS | FlagZ | FlagCY | FlagOV);
+    emitWrite(dr, reg(2));
+    emitReset();
+    return 0;
+  }
+
+  //sub rN, sbc rN, sub #N, cmp rN
+  case 0x60: {
+    mov32_u16(reg(0), sr);
+    if(alt2 && !alt1) mov32(reg(1), imm(n));
+    else mov32_u16(reg(1), R(n));
+    sub32(reg(2), reg(0), reg(1));
+    if(alt1 && !alt2) {
+      mov32_u16(reg(3), SFR);
+      lshr32(reg(3), reg(3), imm(2));
+      and32(reg(3), reg(3), imm(1));
+      xor32(reg(3), reg(3), imm(1));
+      sub32(reg(2), reg(2), reg(3));
+    }
+    xor32(reg(3), reg(0), reg(1));
+    xor32(reg(1), reg(0), reg(2));
+    and32(reg(3), reg(3), reg(1));
+    and32(reg(3), reg(3), imm(0x8000));
+    lshr32(reg(3), reg(3), imm(11));  //ov
+    lshr32(reg(0), reg(2), imm(31));
+    xor32(reg(0), reg(0), imm(1));
+    shl32(reg(0), reg(0), imm(2));    //cy
+    or32(reg(3), reg(3), reg(0));
+    and32(reg(2), reg(2), imm(0xffff));
+    emitSZ(reg(3), reg(2), reg(0));
+    emitFlags(reg(3), reg(0), FlagS | FlagZ | FlagCY | FlagOV);
+    if(!alt2 || !alt1) emitWrite(dr, reg(2));
+    emitReset();
+    return 0;
+  }
+
+  //merge
+  case 0x70: {
+    mov32_u16(reg(0), R(7));
+    and32(reg(0), reg(0), imm(0xff00));
+    mov32_u16(reg(1), R(8));
+    lshr32(reg(1), reg(1), imm(8));
+    or32(reg(0), reg(0), reg(1));
+    mov32(reg(1), imm(0));
+    test32(reg(0), imm(0xc0c0), set_z);
+    mov32_f(reg(2), flag_nz);
+    shl32(reg(2), reg(2), imm(4));
+    or32(reg(1), reg(1), reg(2));
+    test32(reg(0), imm(0x8080), set_z);
+    mov32_f(reg(2), flag_nz);
+    shl32(reg(2), reg(2), imm(3));
+    or32(reg(1), reg(1), reg(2));
+    test32(reg(0), imm(0xe0e0), set_z);
+    mov32_f(reg(2), flag_nz);
+    shl32(reg(2), reg(2), imm(2));
+    or32(reg(1), reg(1), reg(2));
+    test32(reg(0), imm(0xf0f0), set_z);
+    mov32_f(reg(2), flag_nz);
+    shl32(reg(2), reg(2), imm(1));
+    or32(reg(1), reg(1), reg(2));
+    emitFlags(reg(1), reg(2), FlagS | FlagZ | FlagCY | FlagOV);
+    emitWrite(dr, reg(0));
+    emitReset();
+    return 0;
+  }
+
+  //and rN, bic rN, and #N, bic #N
+  case 0x71: {
+    mov32_u16(reg(0), sr);
+    if(alt2) mov32(reg(1), imm(n));
+    else mov32_u16(reg(1), R(n));
+    if(alt1) xor32(reg(1), reg(1), imm(0xffff));
+    and32(reg(0), reg(0), reg(1));
+    mov32(reg(1), imm(0));
+    emitSZ(reg(1), reg(0), reg(2));
+    emitFlags(reg(1), reg(2), FlagS | FlagZ);
+    emitWrite(dr, reg(0));
+    emitReset();
+    return 0;
+  }
+
+  //mult rN, umult rN, mult #N, umult #N
+  case 0x80: {
+    if(!alt1) {
+      mov32_s8(reg(0), sr);
+      if(alt2) mov32(reg(1), imm(n));
+      else mov32_s8(reg(1), R(n));
+    } else {
+      mov32_u8(reg(0), sr);
+      if(alt2) mov32(reg(1), imm(n));
+      else mov32_u8(reg(1), R(n));
+    }
+    mul32(reg(0), reg(0), reg(1));
+    and32(reg(0), reg(0), imm(0xffff));
+    mov32(reg(1), imm(0));
+    emitSZ(reg(1), reg(0), reg(2));
+    emitFlags(reg(1), reg(2), FlagS | FlagZ);
+    emitWrite(dr, reg(0));
+    emitReset();
+    if(!ms0) add32(Cycles, Cycles, imm(clsr ? 1 : 2));
+    return 0;
+  }
+
+  //sbk
+  case 0x90: {
+    emitInterpret(opcode);
+    return 0;
+  }
+
+  //link #N
+  case 0x91: {
+    mov32(reg(0), imm((pc + n) & 0xffff));
+    emitWrite(11, reg(0));
+    emitReset();
+    return 0;
+  }
+
+  //sex
+  case 0x95: {
+    mov32_s8(reg(0), sr);
+    and32(reg(0), reg(0), imm(0xffff));
+    mov32(reg(1), imm(0));
+    emitSZ(reg(1), reg(0), reg(2));
+    emitFlags(reg(1), reg(2), FlagS | FlagZ);
+    emitWrite(dr, reg(0));
+    emitReset();
+    return 0;
+  }
+
+  //asr
+  //div2
+  case 0x96: {
+    mov32_s16(reg(0), sr);
+    and32(reg(1), reg(0), imm(1));
+    shl32(reg(1), reg(1), imm(2));  //cy
+    ashr32(reg(0), reg(0), imm(1));
+    if(alt1) {
+      mov32_u16(reg(2), sr);
+      add32(reg(2), reg(2), imm(1));
+      lshr32(reg(2), reg(2), imm(16));
+      add32(reg(0), reg(0), reg(2));
+    }
+    and32(reg(0), reg(0), imm(0xffff));
+    emitSZ(reg(1), reg(0), reg(2));
+    emitFlags(reg(1), reg(2), FlagS | FlagZ | FlagCY);
+    emitWrite(dr, reg(0));
+    emitReset();
+    return 0;
+  }
+
+  //ror
+  case 0x97: {
+    mov32_u16(reg(0), sr);
+    mov32_u16(reg(2), SFR);
+    and32(reg(2), reg(2), imm(FlagCY));
+    shl32(reg(2), reg(2), imm(13));
+    and32(reg(1), reg(0), imm(1));
+    shl32(reg(1), reg(1), imm(2));  //cy
+    lshr32(reg(0), reg(0), imm(1));
+    or32(reg(0), reg(0), reg(2));
+    emitSZ(reg(1), reg(0), reg(2));
+    emitFlags(reg(1), reg(2), FlagS | FlagZ | FlagCY);
+    emitWrite(dr, reg(0));
+    emitReset();
+    return 0;
+  }
+
+  //jmp rN
+  //ljmp rN
+  case 0x98: {
+    if(alt1) {
+      emitInterpret(opcode);
+      return 1;  //pbr and cbr change
+    }
+    mov32_u16(reg(0), R(n));
+    emitWrite(15, reg(0));
+    emitReset();
+    return 1;
+  }
+
+  //lob
+  case 0x9e: {
+    mov32_u8(reg(0), sr);
+    mov32(reg(1), imm(0));
+    emitSZ(reg(1), reg(0), reg(2), 0x80);
+    emitFlags(reg(1), reg(2), FlagS | FlagZ);
+    emitWrite(dr, reg(0));
+    emitReset();
+    return 0;
+  }
+
+  //fmult
+  //lmult
+  case 0x9f: {
+    mov32_s16(reg(0), sr);
+    mov32_s16(reg(1), R(6));
+    mul32(reg(0), reg(0), reg(1));
+    if(alt1) {
+      and32(reg(1), reg(0), imm(0xffff));
+      emitWrite(4, reg(1));
+    }
+    lshr32(reg(1), reg(0), imm(13));
+    and32(reg(1), reg(1), imm(FlagCY));
+    lshr32(reg(0), reg(0), imm(16));
+    emitSZ(reg(1), reg(0), reg(2));
+    emitFlags(reg(1), reg(2), FlagS | FlagZ | FlagCY);
+    emitWrite(dr, reg(0));
+    emitReset();
+    add32(Cycles, Cycles, imm((ms0 ? 3 : 7) * (clsr ? 1 : 2)));
+    return 0;
+  }
+
+  //ibt rN,#pp
+  //lms rN,(yy)
+  //sms (yy),rN
+  case 0xa0: {
+    if(alt1 || alt2) {
+      emitInterpret(opcode);
+      emitGuard(next);
+      return 0;
+    }
+    mov32_s8(reg(0), Pipeline);
+    and32(sreg(2), reg(0), imm(0xffff));
+    emitFetch(pc + 1, true);
+    emitGuard(next);
+    emitWrite(n, sreg(2));
+    emitReset();
+    return 0;
+  }
+
+  //from rN
+  //moves rN
+  case 0xb0: {
+    if(!with) {
+      mov32(Sreg, imm(n));
+      from = n;
+      return 0;
+    }
+    mov32_u16(reg(0), R(n));
+    lshr32(reg(1), reg(0), imm(3));
+    and32(reg(1), reg(1), imm(FlagOV));
+    emitSZ(reg(1), reg(0), reg(2));
+    emitFlags(reg(1), reg(2), FlagS | FlagZ | FlagOV);
+    emitWrite(dr, reg(0));
+    emitReset();
+    return 0;
+  }
+
+  //hib
+  case 0xc0: {
+    mov32_u16(reg(0), sr);
+    lshr32(reg(0), reg(0), imm(8));
+    mov32(reg(1), imm(0));
+    emitSZ(reg(1), reg(0), reg(2), 0x80);
+    emitFlags(reg(1), reg(2), FlagS | FlagZ);
+    emitWrite(dr, reg(0));
+    emitReset();
+    return 0;
+  }
+
+  //or rN, xor rN, or #N, xor #N
+  case 0xc1: {
+    mov32_u16(reg(0), sr);
+    if(alt2) mov32(reg(1), imm(n));
+    else mov32_u16(reg(1), R(n));
+    if(alt1) xor32(reg(0), reg(0), reg(1));
+    else or32(reg(0), reg(0), reg(1));
+    mov32(reg(1), imm(0));
+    emitSZ(reg(1), reg(0), reg(2));
+    emitFlags(reg(1), reg(2), FlagS | FlagZ);
+    emitWrite(dr, reg(0));
+    emitReset();
+    return 0;
+  }
+
+  //inc rN
+  case 0xd0: {
+    mov32_u16(reg(0), R(n));
+    add32(reg(0), reg(0), imm(1));
+    and32(reg(0), reg(0), imm(0xffff));
+    mov32(reg(1), imm(0));
+    emitSZ(reg(1), reg(0), reg(2));
+    emitFlags(reg(1), reg(2), FlagS | FlagZ);
+    emitWrite(n, reg(0));
+    emitReset();
+    return 0;
+  }
+
+  //getc
+  //ramb
+  //romb
+  case 0xdf: {
+    emitInterpret(opcode);
+    return 0;
+  }
+
+  //dec rN
+  case 0xe0: {
+    mov32_u16(reg(0), R(n));
+    sub32(reg(0), reg(0), imm(1));
+    and32(reg(0), reg(0), imm(0xffff));
+    mov32(reg(1), imm(0));
+    emitSZ(reg(1), reg(0), reg(2));
+    emitFlags(reg(1), reg(2), FlagS | FlagZ);
+    emitWrite(n, reg(0));
+    emitReset();
+    return 0;
+  }
+
+  //getb, getbh, getbl, getbs
+  case 0xef: {
+    //SuperFX::readROMBuffer(), once the ROM buffer has been reloaded
+    mov32(reg(0), Romcl);
+    auto busy = cmp32_jump(reg(0), imm(0), flag_ne);
+    mov32_u8(reg(0), Romdr);
+    switch(alt) {
+    case 0:
+      break;
+    case 1:
+      shl32(reg(0), reg(0), imm(8));
+      mov32_u8(reg(1), sr);
+      or32(reg(0), reg(0), reg(1));
+      break;
+    case 2:
+      mov32_u16(reg(1), sr);
+      and32(reg(1), reg(1), imm(0xff00));
+      or32(reg(0), reg(0), reg(1));
+      break;
+    case 3:
+      mov32_s8(reg(0), reg(0));
+      and32(reg(0), reg(0), imm(0xffff));
+      break;
+    }
+    emitWrite(dr, reg(0));
+    emitReset();
+    auto read = jump();
+    setLabel(busy);
+    emitInterpret(opcode);
+    setLabel(read);
+    return 0;
+  }
+
+  //iwt rN,#xx
+  //lm rN,(xx)
+  //sm (xx),rN
+  case 0xf0: {
+    if(alt1 || alt2) {
+      emitInterpret(opcode);
+      emitGuard(next);
+      return 0;
+    }
+    mov32_u8(sreg(2), Pipeline);
+    emitFetch(pc + 1, true);
+    mov32_u8(reg(0), Pipeline);
+    shl32(reg(0), reg(0), imm(8));
+    or32(sreg(2), sreg(2), reg(0));
+    emitFetch(pc + 2, true);
+    emitGuard(next);
+    emitWrite(n, sreg(2));
+    emitReset();
+    return 0;
+  }
+
+  }
+
+  return 1;
+}
+
+#undef Field
+#undef R
+#undef Modified
+#undef SFR
+#undef Pipeline
+#undef Sreg
+#undef Dreg
+#undef Romcl
+#undef Romdr
+#undef Colr
+#undef Cycles
+#undef Budget
+#undef Status
+#undef FlagZ
+#undef FlagCY
+#undef FlagS
+#undef FlagOV
+#undef FlagR
+#undef FlagALT1
+#undef FlagALT2
+#undef FlagB
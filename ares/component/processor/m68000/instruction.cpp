@@ -1,5 +1,7 @@
 auto M68000::instruction() -> void {
   if(!r.stop) {
+    //the prefetch queue places the program counter two words past the current instruction
+    if(idleLoop && idleLoop.instruction(r.pc - 4)) idleLoopIterate();
     r.ird = r.ir;
     return instructionTable[r.ird]();
   } else {
@@ -7,6 +9,17 @@ auto M68000::instruction() -> void {
   }
 }
 
+auto M68000::idleLoopIterate() -> void {
+  u32 registers[20];
+  for(u32 n : range(8)) registers[0 + n] = r.d[n];
+  for(u32 n : range(8)) registers[8 + n] = r.a[n];
+  registers[16] = r.sp;
+  registers[17] = r.pc;
+  registers[18] = r.ir << 16 | r.irc;
+  registers[19] = r.c << 0 | r.v << 1 | r.z << 2 | r.n << 3 | r.x << 4 | r.i << 5 | r.s << 8 | r.t << 9;
+  if(idleLoop.iterate(registers, 20)) idleLoopDetected();
+}
+
 M68000::M68000() {
   #define bind(id, name, ...) { \
     assert(!instructionTable[id]); \
@@ -38,6 +38,7 @@ auto M68000::power() -> void {
 
   r.stop  = false;
   r.reset = false;
+  idleLoop.reset();
 }
 
 auto M68000::supervisor() -> bool {
@@ -10,6 +10,7 @@ struct M68000 {
   virtual auto read(n1 upper, n1 lower, n24 address, n16 data = 0) -> n16 = 0;
   virtual auto write(n1 upper, n1 lower, n24 address, n16 data) -> void = 0;
   virtual auto lockable() -> bool { return true; }
+  virtual auto idleLoopDetected() -> u32 { return 0; }
 
   auto ird() const -> n16 { return r.ird; }
   auto irc() const -> n16 { return r.irc; }
@@ -124,6 +125,7 @@ struct M68000 {
 
   //instruction.cpp
   auto instruction() -> void;
+  auto idleLoopIterate() -> void;
 
   //traits.cpp
   template<u32 Size> auto bytes() -> u32;
@@ -300,7 +302,9 @@ struct M68000 {
     bool reset;
   } r;
 
-  function<void ()> instructionTable[65536];
+  IdleLoop idleLoop;
+
+  inline_function<void ()> instructionTable[65536];
 
 private:
   //disassembler.cpp
@@ -19,4 +19,5 @@ auto M68000::serialize(serializer& s) -> void {
 
   s(r.stop);
   s(r.reset);
+  idleLoop.reset();
 }
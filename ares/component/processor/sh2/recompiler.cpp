@@ -1,7 +1,7 @@
 #define Reg(r)  mem(sreg(1), offsetof(Registers, r))
-#define RegR(i) mem(sreg(1), offsetof(Registers, R) + (i) * sizeof(u32))
-#define R0      Reg(R[0])
-#define R15     Reg(R[15])
+#define RegR(i) guest(i)
+#define R0      guest(0)
+#define R15     guest(15)
 #define PC      Reg(PC)
 #define PR      Reg(PR)
 #define GBR     Reg(GBR)
@@ -10,7 +10,7 @@
 #define MACL    Reg(MACL)
 #define MACH    Reg(MACH)
 #define CCR     Reg(CCR)
-#define T       Reg(SR.T)
+#define T       guest(16)
 #define S       Reg(SR.S)
 #define I       Reg(SR.I)
 #define Q       Reg(SR.Q)
@@ -81,7 +81,7 @@ auto SH2::Recompiler::block(u32 address) -> Block* {
     return result->block;
   }
 
-  auto block = emit(address);
+  auto block = emit(address, size);
   assert(block->size == size);
   pool(address)->blocks[address >> 1 & 0x7f] = block;
   memory::jitprotect(true);
@@ -112,7 +112,7 @@ auto SH2::Recompiler::hash(u32 address, u8 size) -> u64 {
   return XXH3_64bits(&instructions[address >> 1 & 0x7f], size ? size : 0x100);
 }
 
-auto SH2::Recompiler::emit(u32 address) -> Block* {
+auto SH2::Recompiler::emit(u32 address, u8 size) -> Block* {
   if(unlikely(allocator.available() < 1_MiB)) {
     print("SH2 allocator flush\n");
     memory::jitprotect(false);
@@ -122,11 +122,14 @@ auto SH2::Recompiler::emit(u32 address) -> Block* {
   }
 
   auto block = (Block*)allocator.acquire(sizeof(Block));
-  beginFunction(2);
+  beginFunction(2, 3 + HostRegisters);
+  allocateRegisters(address, size);
+  loadRegisters();
 
   u32 start = address;
   u32 index = address >> 1 & 0x7f;
   bool hasBranched = 0;
+  vector<sljit_jump*> exits;
   inDelaySlot = 1;  //force runtime check on first instruction
   while(true) {
     u16 instruction = instructions[index++];
@@ -138,8 +141,10 @@ auto SH2::Recompiler::emit(u32 address) -> Block* {
     address += 2;
     if(hasBranched || (address & 0xfe) == 0) break;  //block boundary
     hasBranched = branch != Branch::Step;
-    testJumpEpilog();
+    exits.append(cmp32_jump(reg(0), imm(0), flag_ne));
   }
+  for(auto exit : exits) setLabel(exit);
+  storeRegisters();
   jumpEpilog();
 
   memory::jitprotect(false);
@@ -149,6 +154,103 @@ auto SH2::Recompiler::emit(u32 address) -> Block* {
   return block;
 }
 
+auto SH2::Recompiler::allocateRegisters(u32 address, u8 size) -> void {
+  for(auto& index : host) index = -1;
+  if constexpr(Accuracy::CachedInterpreter) return;
+
+  u32 counts[17] = {};
+  u32 index = address >> 1 & 0x7f;
+  for(u32 n : range(size ? size >> 1 : 0x80)) uses(instructions[(index + n) & 0x7f], counts);
+
+  //the most used registers are held in host registers; one access alone gains nothing
+  for(u32 slot : range(HostRegisters)) {
+    u32 best = 0;
+    for(u32 n : range(1, 17)) {
+      if(counts[n] > counts[best]) best = n;
+    }
+    if(counts[best] < 2) break;
+    host[best] = 3 + slot;
+    counts[best] = 0;
+  }
+}
+
+//estimates how often each instruction reads or writes R0-R15 and SR.T.
+//only the choice of registers to hold depends on this, never correctness.
+auto SH2::Recompiler::uses(u16 opcode, u32 counts[17]) -> void {
+  u32 n = opcode >> 8 & 15;
+  u32 m = opcode >> 4 & 15;
+  u32 d = opcode >> 0 & 15;
+  switch(opcode >> 12) {
+  case 0x0:
+    if(d == 0x4 || d == 0x5 || d == 0x6 || d == 0xc || d == 0xd || d == 0xe) {
+      counts[n]++, counts[m]++, counts[0]++;                       //MOV @(R0,Rn)
+    } else if(d == 0x7 || d == 0xf) {
+      counts[n]++, counts[m]++;                                    //MUL.L, MAC.L
+    } else if(d == 0x8 || d == 0x9) {
+      counts[16]++;                                                //CLRT, SETT, DIV0U, MOVT
+      if(m == 0x2) counts[n]++;
+    } else if(d != 0xb) {
+      counts[n]++;                                                 //STC, STS, BSRF, BRAF
+    }
+    break;
+  case 0x1: case 0x5:
+    counts[n]++, counts[m]++;
+    break;
+  case 0x2:
+    counts[n]++, counts[m]++;
+    if(d == 0x7 || d == 0x8 || d == 0xc) counts[16]++;             //DIV0S, TST, CMP/STR
+    break;
+  case 0x3:
+    counts[n]++, counts[m]++;
+    if(d != 0x5 && d != 0x8 && d != 0xc && d != 0xd) counts[16]++;  //CMP, DIV1, ADDC, SUBC, ADDV, SUBV
+    break;
+  case 0x4:
+    counts[n]++;
+    if((opcode & 0xc2) == 0x00) counts[16]++;                      //shifts, rotates, DT, CMP/PZ, CMP/PL
+    break;
+  case 0x6:
+    counts[n]++, counts[m]++;
+    if(d == 0xa) counts[16]++;                                     //NEGC
+    break;
+  case 0x7: case 0x9: case 0xd: case 0xe:
+    counts[n]++;
+    break;
+  case 0x8:
+    if(n == 0x0 || n == 0x1 || n == 0x4 || n == 0x5) counts[m]++, counts[0]++;
+    else if(n == 0x8) counts[0]++, counts[16]++;                   //CMP/EQ #imm,R0
+    else counts[16]++;                                             //BT, BF, BT/S, BF/S
+    break;
+  case 0xc:
+    if(n == 0x3) counts[15]++;                                     //TRAPA
+    else counts[0]++;
+    if(n == 0x8) counts[16]++;                                     //TST #imm,R0
+    break;
+  }
+}
+
+//held registers must be stored before calling anything that reads them from Registers
+auto SH2::Recompiler::loadRegisters() -> void {
+  for(u32 n : range(17)) {
+    if(host[n] >= 0) mov32(sreg(host[n]), location(n));
+  }
+}
+
+auto SH2::Recompiler::storeRegisters() -> void {
+  for(u32 n : range(17)) {
+    if(host[n] >= 0) mov32(location(n), sreg(host[n]));
+  }
+}
+
+auto SH2::Recompiler::guest(u32 index) -> op_base {
+  if(host[index] >= 0) return sreg(host[index]);
+  return location(index);
+}
+
+auto SH2::Recompiler::location(u32 index) -> mem {
+  if(index < 16) return mem(sreg(1), offsetof(Registers, R) + index * sizeof(u32));
+  return mem(sreg(1), offsetof(Registers, SR));  //SR.T is the first field of S32
+}
+
 #define readB   &SH2::readByte<>
 #define readW   &SH2::readWord<>
 #define readL   &SH2::readLong<>
@@ -1465,7 +1567,9 @@ auto SH2::Recompiler::emitInstruction(u16 opcode) -> u32 {
 
   //ILLEGAL
   case 0: {
+    storeRegisters();
     call(illegal);
+    loadRegisters();
     return Branch::Take;
   }
 
@@ -1521,7 +1625,9 @@ auto SH2::Recompiler::checkDelaySlot(F body) -> void {
   body();
   auto skip2 = jump();
   setLabel(skip);
+  storeRegisters();
   call(&SH2::illegalSlotInstruction);
+  loadRegisters();
   setLabel(skip2);
 }
 
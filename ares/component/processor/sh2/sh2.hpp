@@ -247,6 +247,9 @@ struct SH2 {
 
   s32 cyclesUntilSync = 0;
   s32 minCyclesBetweenSyncs = 0;
+  s32 maxCyclesBetweenSyncs = 0;  //slices grow toward this while no shared memory is accessed
+  s32 cyclesBetweenSyncs = 0;
+  bool sharedAccess = 0;          //set by uncached accesses, which other processors may observe
 
   struct Recompiler : recompiler::generic {
     SH2& self;
@@ -290,14 +293,24 @@ struct SH2 {
     auto block(u32 address) -> Block*;
     auto measure(u32 address) -> u8;
     auto hash(u32 address, u8 size) -> u64;
-    auto emit(u32 address) -> Block*;
+    auto emit(u32 address, u8 size) -> Block*;
     auto emitInstruction(u16 opcode) -> u32;
+    auto allocateRegisters(u32 address, u8 size) -> void;
+    auto loadRegisters() -> void;
+    auto storeRegisters() -> void;
+    auto guest(u32 index) -> op_base;
+    auto location(u32 index) -> mem;
     auto getSR(reg dst) -> void;
     auto setSR(reg src) -> void;
     template<typename F> auto checkDelaySlot(F body) -> void;
     auto isTerminal(u16 instruction) -> bool;
 
     static auto mask(u8 address, u8 size) -> u64;
+    static auto uses(u16 opcode, u32 counts[17]) -> void;
+
+    //R0-R15 and SR.T (index 16) may be held in the saved host registers above sreg(2)
+    static constexpr u32 HostRegisters = SLJIT_NUMBER_OF_SAVED_REGISTERS - 3 < 8 ? SLJIT_NUMBER_OF_SAVED_REGISTERS - 3 : 8;
+    s8 host[17];  //sreg index holding each guest register, or -1 when it is accessed in memory
 
     bool inDelaySlot;
     u32 generation;
@@ -9,6 +9,7 @@ template<u32 Origin> auto SH2::readByte(u32 address) -> u32 {
   }
 
   case Area::Uncached: {
+    sharedAccess = 1;
     return busReadByte(address & 0x1fff'ffff);
   }
 
@@ -48,6 +49,7 @@ template<u32 Origin> auto SH2::readWord(u32 address) -> u32 {
   }
 
   case Area::Uncached: {
+    sharedAccess = 1;
     return busReadWord(address & 0x1fff'fffe);
   }
 
@@ -85,6 +87,7 @@ template<u32 Origin> auto SH2::readLong(u32 address) -> u32 {
   }
 
   case Area::Uncached: {
+    sharedAccess = 1;
     return busReadLong(address & 0x1fff'fffc);
   }
 
@@ -138,6 +141,7 @@ template<u32 Origin> auto SH2::writeByte(u32 address, u32 data) -> void {
 
   case Area::Uncached: {
     cyclesUntilSync = 0;
+    sharedAccess = 1;
     return busWriteByte(address & 0x1fff'ffff, data);
   }
 
@@ -187,6 +191,7 @@ template<u32 Origin> auto SH2::writeWord(u32 address, u32 data) -> void {
 
   case Area::Uncached: {
     cyclesUntilSync = 0;
+    sharedAccess = 1;
     return busWriteWord(address & 0x1fff'fffe, data);
   }
 
@@ -233,6 +238,7 @@ template<u32 Origin> auto SH2::writeLong(u32 address, u32 data) -> void {
 
   case Area::Uncached: {
     cyclesUntilSync = 0;
+    sharedAccess = 1;
     return busWriteLong(address & 0x1fff'fffc, data);
   }
 
@@ -1,6 +1,7 @@
 #define op(id, name, ...) case id: return instruction##name(__VA_ARGS__);
 
 auto SM83::instruction() -> void {
+  if(idleLoop && idleLoop.instruction(PC)) idleLoopIterate();
   auto opcode = operand();
 
   switch(opcode) {
@@ -352,4 +353,14 @@ auto SM83::instructionCB() -> void {
   }
 }
 
+auto SM83::idleLoopIterate() -> void {
+  u32 registers[] = {
+    (u32)AF << 16 | BC,
+    (u32)DE << 16 | HL,
+    (u32)SP << 16 | PC,
+    (u32)r.ei << 0 | r.halt << 1 | r.stop << 2 | r.ime << 3 | r.haltBug << 4,
+  };
+  if(idleLoop.iterate(registers, 4)) idleLoopDetected();
+}
+
 #undef op
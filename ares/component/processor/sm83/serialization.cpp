@@ -9,4 +9,5 @@ auto SM83::serialize(serializer& s) -> void {
   s(r.halt);
   s(r.stop);
   s(r.ime);
+  idleLoop.reset();
 }
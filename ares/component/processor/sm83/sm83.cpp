@@ -13,6 +13,7 @@ namespace ares {
 
 auto SM83::power() -> void {
   r = {};
+  idleLoop.reset();
 }
 
 }
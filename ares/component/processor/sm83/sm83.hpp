@@ -16,6 +16,7 @@ struct SM83 {
   virtual auto read(n16 address) -> n8 = 0;
   virtual auto write(n16 address, n8 data) -> void = 0;
   virtual auto haltBugTrigger() -> void = 0;
+  virtual auto idleLoopDetected() -> u32 { return 0; }
 
   //sm83.cpp
   auto power() -> void;
@@ -23,6 +24,7 @@ struct SM83 {
   //instruction.cpp
   auto instruction() -> void;
   auto instructionCB() -> void;
+  auto idleLoopIterate() -> void;
 
   //serialization.cpp
   auto serialize(serializer&) -> void;
@@ -181,6 +183,8 @@ struct SM83 {
     n1 haltBug;
   } r;
 
+  IdleLoop idleLoop;
+
   //disassembler.cpp
   auto disassembleOpcode(n16 pc) -> string;
   auto disassembleOpcodeCB(n16 pc) -> string;
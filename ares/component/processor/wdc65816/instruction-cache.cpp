@@ -0,0 +1,84 @@
+//every fetch within an instruction reads the byte after the one before it, starting from the
+//opcode, so the bytes cached at the PC serve all of them. instructions that use fewer bytes
+//leave the rest unused, and the next instruction looks up its own entry.
+
+//the same four instruction tables as instruction(), indexed by mode (MF << 1 | XF) and opcode.
+//cached entries store the handler, so the opcode and the M/X flags are decoded once per entry.
+//cycle counts are not decoded: they come from each bus access, and ROM speed can change at any
+//time via MEMSEL, so fetched() still accounts for every cached byte.
+auto WDC65816::decode(u32 mode, n8 opcode) -> Handler {
+  struct Table { Handler handlers[4][256]; };
+  static const Table table = [] {
+    Table table;
+    #define handler(...) [](WDC65816& self) { [[maybe_unused]] auto& r = self.r; self.__VA_ARGS__; }
+    #define opA(id, name, ...) table.handlers[mode][id] = handler(instruction##name(__VA_ARGS__));
+    for(u32 mode : range(4)) {
+      if(mode & 2) {
+        #define opM(id, name, ...) table.handlers[mode][id] = handler(instruction##name##8(__VA_ARGS__));
+        #define m(name) &WDC65816::algorithm##name##8
+        if(mode & 1) {
+          #define opX(id, name, ...) table.handlers[mode][id] = handler(instruction##name##8(__VA_ARGS__));
+          #define x(name) &WDC65816::algorithm##name##8
+          #include "instruction.hpp"
+          #undef opX
+          #undef x
+        } else {
+          #define opX(id, name, ...) table.handlers[mode][id] = handler(instruction##name##16(__VA_ARGS__));
+          #define x(name) &WDC65816::algorithm##name##16
+          #include "instruction.hpp"
+          #undef opX
+          #undef x
+        }
+        #undef opM
+        #undef m
+      } else {
+        #define opM(id, name, ...) table.handlers[mode][id] = handler(instruction##name##16(__VA_ARGS__));
+        #define m(name) &WDC65816::algorithm##name##16
+        if(mode & 1) {
+          #define opX(id, name, ...) table.handlers[mode][id] = handler(instruction##name##8(__VA_ARGS__));
+          #define x(name) &WDC65816::algorithm##name##8
+          #include "instruction.hpp"
+          #undef opX
+          #undef x
+        } else {
+          #define opX(id, name, ...) table.handlers[mode][id] = handler(instruction##name##16(__VA_ARGS__));
+          #define x(name) &WDC65816::algorithm##name##16
+          #include "instruction.hpp"
+          #undef opX
+          #undef x
+        }
+        #undef opM
+        #undef m
+      }
+    }
+    #undef opA
+    #undef handler
+    return table;
+  }();
+  return table.handlers[mode][opcode];
+}
+
+auto WDC65816::cacheInstruction() -> Handler {
+  cache.remaining = 0;
+
+  //the PC wraps within its bank, where the following bytes are not contiguous
+  if(PC.w > 0x10000 - InstructionCache::Bytes) return nullptr;
+
+  u32 mode = MF << 1 | XF;
+  u32 key = PC.d | mode << 24;
+  auto& entry = cache.entries[(PC.d ^ PC.d >> 12 ^ mode << 10) & (InstructionCache::Entries - 1)];
+  if(entry.key != key) {
+    auto data = fetchable(PC.d);
+    entry.key = key;
+    entry.handler = nullptr;
+    if(data) {
+      for(u32 n : range(InstructionCache::Bytes)) entry.data[n] = data[n];
+      entry.handler = decode(mode, entry.data[0]);
+    }
+  }
+  if(!entry.handler) return nullptr;
+
+  cache.next = entry.data;
+  cache.remaining = InstructionCache::Bytes;
+  return entry.handler;
+}
@@ -21,6 +21,13 @@ auto WDC65816::instruction() -> void {
   //a = instructions unaffected by M/X flags
   //m = instructions affected by M flag (1 = 8-bit; 0 = 16-bit)
   //x = instructions affected by X flag (1 = 8-bit; 0 = 16-bit)
+  if(idleLoop && idleLoop.instruction(PC.d)) idleLoopIterate();
+  if(cache) {
+    if(auto handler = cacheInstruction()) {
+      fetch();  //the opcode the handler was decoded from
+      return handler(*this);
+    }
+  }
 
   #define opA(id, name, ...) case id: return instruction##name(__VA_ARGS__);
   if(MF) {
@@ -29,13 +36,17 @@ auto WDC65816::instruction() -> void {
     if(XF) {
       #define opX(id, name, ...) case id: return instruction##name##8(__VA_ARGS__);
       #define x(name) &WDC65816::algorithm##name##8
+      switch(fetch()) {
       #include "instruction.hpp"
+      }
       #undef opX
       #undef x
     } else {
       #define opX(id, name, ...) case id: return instruction##name##16(__VA_ARGS__);
       #define x(name) &WDC65816::algorithm##name##16
+      switch(fetch()) {
       #include "instruction.hpp"
+      }
       #undef opX
       #undef x
     }
@@ -47,13 +58,17 @@ auto WDC65816::instruction() -> void {
     if(XF) {
       #define opX(id, name, ...) case id: return instruction##name##8(__VA_ARGS__);
       #define x(name) &WDC65816::algorithm##name##8
+      switch(fetch()) {
       #include "instruction.hpp"
+      }
       #undef opX
       #undef x
     } else {
       #define opX(id, name, ...) case id: return instruction##name##16(__VA_ARGS__);
       #define x(name) &WDC65816::algorithm##name##16
+      switch(fetch()) {
       #include "instruction.hpp"
+      }
       #undef opX
       #undef x
     }
@@ -62,3 +77,14 @@ auto WDC65816::instruction() -> void {
   }
   #undef opA
 }
+
+auto WDC65816::idleLoopIterate() -> void {
+  u32 registers[] = {
+    (u32)r.pc.d,
+    (u32)r.a.w << 16 | r.x.w,
+    (u32)r.y.w << 16 | r.s.w,
+    (u32)r.d.w << 16 | r.b << 8 | r.p,
+    (u32)r.e << 0 | r.wai << 1 | r.stp << 2,
+  };
+  if(idleLoop.iterate(registers, 5)) idleLoopDetected();
+}
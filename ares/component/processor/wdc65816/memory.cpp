@@ -28,6 +28,12 @@ inline auto WDC65816::idle6(n16 address) -> void {
 }
 
 inline auto WDC65816::fetch() -> n8 {
+  if(cache.remaining) {
+    cache.remaining--;
+    n8 data = *cache.next++;
+    fetched(PC.b << 16 | PC.w++, data);
+    return data;
+  }
   return read(PC.b << 16 | PC.w++);
 }
 
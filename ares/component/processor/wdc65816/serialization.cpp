@@ -30,4 +30,6 @@ auto WDC65816::serialize(serializer& s) -> void {
   s(r.u.d);
   s(r.v.d);
   s(r.w.d);
+  idleLoop.reset();
+  cache.flush();
 }
@@ -13,6 +13,7 @@ namespace ares {
 #include "instructions-pc.cpp"
 #include "instructions-other.cpp"
 #include "instruction.cpp"
+#include "instruction-cache.cpp"
 
 auto WDC65816::power() -> void {
   r.pc.d = 0x000000;
@@ -32,6 +33,8 @@ auto WDC65816::power() -> void {
   r.mdr = 0x00;
 
   r.vector = 0xfffc;  //reset vector address
+  idleLoop.reset();
+  cache.flush();
 }
 
 #include "registers.hpp"
@@ -16,6 +16,9 @@ struct WDC65816 {
   virtual auto interruptPending() const -> bool = 0;
   virtual auto interrupt() -> void;
   virtual auto synchronizing() const -> bool = 0;
+  virtual auto idleLoopDetected() -> u32 { return 0; }
+  virtual auto fetchable(n24 address) -> const n8* { return nullptr; }
+  virtual auto fetched(n24 address, n8 data) -> void {}
 
   virtual auto readDisassembler(n24 address) -> n8 { return 0; }
 
@@ -229,6 +232,12 @@ struct WDC65816 {
 
   //instruction.cpp
   auto instruction() -> void;
+  auto idleLoopIterate() -> void;
+
+  //instruction-cache.cpp
+  using Handler = void (*)(WDC65816&);
+  static auto decode(u32 mode, n8 opcode) -> Handler;
+  auto cacheInstruction() -> Handler;
 
   //serialization.cpp
   auto serialize(serializer&) -> void;
@@ -289,6 +298,43 @@ struct WDC65816 {
     r24 v;  //temporary register
     r24 w;  //temporary register
   } r;
+
+  //code running from read-only memory is fetched from a cache of its bytes, rather than through
+  //the bus. the core supplies these bytes with fetchable(), which returns InstructionCache::Bytes
+  //bytes of read-only memory at an address, or nullptr. each cached fetch calls fetched() instead
+  //of read(), which must still perform every step of the read cycle other than the bus access.
+  //entries also hold the decoded instruction, so they are keyed by the M/X flags as well as the PC.
+  struct InstructionCache {
+    static constexpr u32 Entries = 4096;
+    static constexpr u32 Bytes = 4;  //an opcode and its longest operand
+
+    explicit operator bool() const { return enable; }
+
+    auto setEnabled(bool enabled) -> void {
+      flush();
+      enable = enabled;
+    }
+
+    //must be called whenever the bytes fetchable() returns may have changed
+    auto flush() -> void {
+      for(auto& entry : entries) entry.key = ~0;
+      remaining = 0;
+    }
+
+    struct Entry {
+      u32 key = ~0;               //PC | MF << 25 | XF << 24
+      Handler handler = nullptr;  //nullptr when the bytes at the PC are not cacheable
+      n8 data[Bytes];
+    };
+
+    bool enable = false;
+    u32 remaining = 0;  //bytes of the current instruction that may still be fetched from next
+    const n8* next = nullptr;
+    Entry entries[Entries];
+  };
+
+  IdleLoop idleLoop;
+  InstructionCache cache;
 };
 
 }
@@ -6,6 +6,8 @@ auto Z80::instruction() -> void {
     return wait(1);
   }
 
+  if(idleLoop && idleLoop.instruction(PC)) idleLoopIterate();
+
   n8 code;
   while(true) {
     R.bit(0,6)++;
@@ -913,4 +915,24 @@ auto Z80::instructionED(n8 code) -> void {
   return instructionNOP();
 }
 
+//R is excluded from the compared state: it advances with every instruction. it is instead
+//advanced by the amount one iteration adds for every iteration skipped, so that it stays exact.
+auto Z80::idleLoopIterate() -> void {
+  u32 registers[] = {
+    (u32)AF << 16 | BC,
+    (u32)DE << 16 | HL,
+    (u32)af_.word << 16 | bc_.word,
+    (u32)de_.word << 16 | hl_.word,
+    (u32)IX << 16 | IY,
+    (u32)I << 16 | WZ,
+    (u32)SP << 16 | PC,
+    (u32)EI << 0 | P << 1 | Q << 2 | IFF1 << 3 | IFF2 << 4 | IM << 5 | (u32)prefix << 7,
+  };
+  if(idleLoop.iterate(registers, 8)) {
+    n7 refresh = R - idleLoopRefresh;
+    R.bit(0,6) += refresh * idleLoopDetected();
+  }
+  idleLoopRefresh = R;
+}
+
 #undef op
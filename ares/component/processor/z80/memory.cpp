@@ -36,21 +36,25 @@ auto Z80::displace(n16& x, u32 wclocks) -> n16 {
 }
 
 auto Z80::read(n16 address) -> n8 {
+  if(idleLoop) idleLoop.reading(address);
   step(3);
   return bus->read(address);
 }
 
 auto Z80::write(n16 address, n8 data) -> void {
+  if(idleLoop) idleLoop.writing();
   step(3);
   return bus->write(address, data);
 }
 
 auto Z80::in(n16 address) -> n8 {
+  if(idleLoop) idleLoop.reading(1 << 16 | address);
   step(4);
   return bus->in(address);
 }
 
 auto Z80::out(n16 address, n8 data) -> void {
+  if(idleLoop) idleLoop.writing();
   step(4);
   return bus->out(address, data);
 }
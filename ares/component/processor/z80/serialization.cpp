@@ -22,4 +22,5 @@ auto Z80::serialize(serializer& s) -> void {
   s(IFF1);
   s(IFF2);
   s(IM);
+  idleLoop.reset();
 }
@@ -32,6 +32,7 @@ auto Z80::power(MOSFET mosfet) -> void {
   IFF1 = 0;
   IFF2 = 0;
   IM = 0;
+  idleLoop.reset();
 }
 
 auto Z80::reset() -> void {
@@ -43,6 +44,7 @@ auto Z80::reset() -> void {
   IFF1 = 0;
   IFF2 = 0;
   IM = 0;
+  idleLoop.reset();
 }
 
 auto Z80::irq(n8 extbus) -> bool {
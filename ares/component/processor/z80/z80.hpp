@@ -15,6 +15,7 @@ struct Z80 {
 
   virtual auto step(u32 clocks) -> void = 0;
   virtual auto synchronizing() const -> bool = 0;
+  virtual auto idleLoopDetected() -> u32 { return 0; }
 
   //CMOS: out (c) writes 0x00
   //NMOS: out (c) writes 0xff; if an interrupt fires during "ld a,i" or "ld a,r", PF is cleared
@@ -47,6 +48,7 @@ struct Z80 {
   auto instructionCB(n8 code) -> void;
   auto instructionCBd(n16 address, n8 code) -> void;
   auto instructionED(n8 code) -> void;
+  auto idleLoopIterate() -> void;
 
   //algorithms.cpp
   auto ADD(n8, n8, bool = false) -> n8;
@@ -248,6 +250,9 @@ struct Z80 {
   n2  IM;    //interrupt mode (0-2)
 
   Bus* bus = nullptr;
+
+  IdleLoop idleLoop;
+  n7 idleLoopRefresh;  //R at the previous loop iteration
 };
 
 }
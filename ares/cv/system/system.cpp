@@ -16,7 +16,7 @@ auto load(Node::System& node, string name) -> bool {
   return system.load(node, name);
 }
 
-Scheduler scheduler;
+instance_local Scheduler scheduler;
 System system;
 #include "controls.cpp"
 #include "serialization.cpp"
@@ -2,7 +2,7 @@
 
 namespace ares::Famicom {
 
-APU apu;
+instance_local APU apu;
 #include "envelope.cpp"
 #include "sweep.cpp"
 #include "pulse.cpp"
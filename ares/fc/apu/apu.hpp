@@ -163,4 +163,4 @@ struct APU {
   static const n16 noisePeriodTablePAL[16];
 };
 
-extern APU apu;
+extern instance_local APU apu;
@@ -25,10 +25,29 @@ struct Interface {
 
   virtual auto serialize(serializer&) -> void {}
 
+  //host memory backing each 8KB page of the CPU bus and each 1KB page of the PPU pattern tables.
+  //boards whose reads have no side effects keep these current as their bank registers change,
+  //so that fetches can bypass readPRG() and readCHR(); unmapped (null) pages take the slow path.
+  const n8* programPage[8] = {};
+  const n8* characterPage[8] = {};
+
+  //set by boards whose readPRG() has no side effects below $6000, so that reads of internal RAM
+  //and of the PPU and APU registers, whose cartridge result is discarded, need not call it at all.
+  bool passiveIO = false;
+
 protected:
   auto load(Memory::Readable<n8>& memory, string name) -> bool;
   auto load(Memory::Writable<n8>& memory, string name) -> bool;
   auto save(Memory::Writable<n8>& memory, string name) -> bool;
+
+  //memory smaller than a page is left unmapped, as it must be mirrored within the page
+  template<typename T> auto mapPRG(u32 page, T& memory, u32 address) -> void {
+    programPage[page] = memory.mask() >= 0x1fff ? memory.data() + (address & memory.mask() & ~0x1fff) : nullptr;
+  }
+
+  template<typename T> auto mapCHR(u32 page, T& memory, u32 address) -> void {
+    characterPage[page] = memory.mask() >= 0x03ff ? memory.data() + (address & memory.mask() & ~0x03ff) : nullptr;
+  }
 };
 
 }
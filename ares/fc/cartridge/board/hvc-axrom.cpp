@@ -39,6 +39,7 @@ struct HVC_AxROM : Interface {
     if(address < 0x8000) return;
     programBank = data.bit(0,3);
     mirror = data.bit(4);
+    updatePages();
   }
 
   auto readCHR(n32 address, n8 data) -> n8 override {
@@ -53,14 +54,25 @@ struct HVC_AxROM : Interface {
     if(characterRAM) return characterRAM.write(address, data);
   }
 
+  auto updatePages() -> void {
+    for(u32 page : range(4, 8)) mapPRG(page, programROM, programBank << 15 | (n15)(page << 13));
+    for(u32 page : range(8)) {
+      if(characterROM) mapCHR(page, characterROM, page << 10);
+      else if(characterRAM) mapCHR(page, characterRAM, page << 10);
+    }
+  }
+
   auto power() -> void override {
+    passiveIO = true;
     programBank = 0x0f;
+    updatePages();
   }
 
   auto serialize(serializer& s) -> void override {
     s(characterRAM);
     s(programBank);
     s(mirror);
+    updatePages();
   }
 
   n4 programBank;
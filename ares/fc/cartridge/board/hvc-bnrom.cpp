@@ -27,6 +27,7 @@ struct HVC_BNROM : Interface {
   auto writePRG(n32 address, n8 data) -> void override {
     if(address < 0x8000) return;
     programBank = data;
+    updatePages();
   }
 
   auto readCHR(n32 address, n8 data) -> n8 override {
@@ -47,13 +48,24 @@ struct HVC_BNROM : Interface {
     if(characterRAM) return characterRAM.write(address, data);
   }
 
+  auto updatePages() -> void {
+    for(u32 page : range(4, 8)) mapPRG(page, programROM, programBank << 15 | (n15)(page << 13));
+    for(u32 page : range(8)) {
+      if(characterROM) mapCHR(page, characterROM, page << 10);
+      else if(characterRAM) mapCHR(page, characterRAM, page << 10);
+    }
+  }
+
   auto power() -> void override {
+    passiveIO = true;
+    updatePages();
   }
 
   auto serialize(serializer& s) -> void override {
     s(characterRAM);
     s(mirror);
     s(programBank);
+    updatePages();
   }
 
   n1 mirror;  //0 = horizontal, 1 = vertical
@@ -39,6 +39,7 @@ struct HVC_CNROM : Interface {
     if(address < 0x8000) return;
     characterBank = data & programROM.read((n15)address);
     characterEnable = (data == key);
+    updatePages();
   }
 
   auto readCHR(n32 address, n8 data) -> n8 override {
@@ -69,12 +70,33 @@ struct HVC_CNROM : Interface {
     }
   }
 
+  auto updatePages() -> void {
+    for(u32 page : range(4, 8)) mapPRG(page, programROM, (n15)(page << 13));
+    for(u32 page : range(8)) {
+      if(revision == Revision::CPROM) {
+        n2 bank = page < 4 ? (n2)0 : characterBank;
+        mapCHR(page, characterRAM, bank << 12 | (n12)(page << 10));
+      } else if(revision == Revision::CNROMS) {
+        if(characterEnable) mapCHR(page, characterROM, page << 10);
+        else characterPage[page] = nullptr;
+      } else {
+        mapCHR(page, characterROM, characterBank << 13 | page << 10);
+      }
+    }
+  }
+
+  auto power() -> void override {
+    passiveIO = true;
+    updatePages();
+  }
+
   auto serialize(serializer& s) -> void override {
     s(characterRAM);
     s(mirror);
     s(key);
     s(characterBank);
     s(characterEnable);
+    updatePages();
   }
 
   n1 mirror;  //0 = horizontal, 1 = vertical
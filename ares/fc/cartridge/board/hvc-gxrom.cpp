@@ -36,6 +36,7 @@ struct HVC_GxROM : Interface {
     if(address < 0x8000) return;
     characterBank = data.bit(0,1);
     programBank = data.bit(4,5);
+    updatePages();
   }
 
   auto readCHR(n32 address, n8 data) -> n8 override {
@@ -58,7 +59,17 @@ struct HVC_GxROM : Interface {
     if(characterRAM) return characterRAM.write(address, data);
   }
 
+  auto updatePages() -> void {
+    for(u32 page : range(4, 8)) mapPRG(page, programROM, programBank << 15 | (n15)(page << 13));
+    for(u32 page : range(8)) {
+      if(characterROM) mapCHR(page, characterROM, characterBank << 13 | page << 10);
+      else if(characterRAM) mapCHR(page, characterRAM, characterBank << 13 | page << 10);
+    }
+  }
+
   auto power() -> void override {
+    passiveIO = true;
+    updatePages();
   }
 
   auto serialize(serializer& s) -> void override {
@@ -66,6 +77,7 @@ struct HVC_GxROM : Interface {
     s(mirror);
     s(programBank);
     s(characterBank);
+    updatePages();
   }
 
   n1 mirror;  //0 = horizontal, 1 = vertical
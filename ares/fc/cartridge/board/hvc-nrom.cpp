@@ -55,12 +55,24 @@ struct HVC_NROM : Interface {
     if(characterRAM) return characterRAM.write(address, data);
   }
 
+  auto updatePages() -> void {
+    mapPRG(3, programRAM, 0x6000);
+    for(u32 page : range(4, 8)) mapPRG(page, programROM, page << 13);
+    for(u32 page : range(8)) {
+      if(characterROM) mapCHR(page, characterROM, page << 10);
+      else if(characterRAM) mapCHR(page, characterRAM, page << 10);
+    }
+  }
+
   auto power() -> void override {
+    passiveIO = true;
+    updatePages();
   }
 
   auto serialize(serializer& s) -> void override {
     s(characterRAM);
     s(mirror);
+    updatePages();
   }
 
   n1 mirror;  //0 = horizontal, 1 = vertical
@@ -192,6 +192,7 @@ struct HVC_SxROM : Interface {  //MMC1
         }
       }
     }
+    updatePages();
   }
 
   auto readCHR(n32 address, n8 data) -> n8 override {
@@ -206,10 +207,23 @@ struct HVC_SxROM : Interface {  //MMC1
     if(characterRAM) return characterRAM.write(addressCHR(address), data);
   }
 
+  auto updatePages() -> void {
+    if(revision == Revision::SNROM && characterBank[0].bit(4)) programPage[3] = nullptr;
+    else if(ramDisable) programPage[3] = nullptr;
+    else mapPRG(3, programRAM, addressProgramRAM(0x6000));
+    for(u32 page : range(4, 8)) mapPRG(page, programROM, addressProgramROM(page << 13));
+    for(u32 page : range(8)) {
+      if(characterROM) mapCHR(page, characterROM, addressCHR(page << 10));
+      else if(characterRAM) mapCHR(page, characterRAM, addressCHR(page << 10));
+    }
+  }
+
   auto power() -> void override {
+    passiveIO = true;
     programMode = 1;
     programSize = 1;
     characterBank[1] = 1;
+    updatePages();
   }
 
   auto serialize(serializer& s) -> void override {
@@ -225,6 +239,7 @@ struct HVC_SxROM : Interface {  //MMC1
     s(characterBank);
     s(programBank);
     s(ramDisable);
+    updatePages();
   }
 
   n8 writeDelay;
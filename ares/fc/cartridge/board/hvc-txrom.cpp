@@ -79,14 +79,7 @@ struct HVC_TxROM : Interface {  //MMC3
     characterAddress = address;
   }
 
-  auto readPRG(n32 address, n8 data) -> n8 override {
-    if(address < 0x6000) return data;
-
-    if(address < 0x8000) {
-      if(!ramEnable || !programRAM) return data;
-      return programRAM.read((n13)address);
-    }
-
+  auto addressPRG(n32 address) const -> n32 {
     n6 bank;
     switch(address >> 13 & 3) {
     case 0: bank = (programMode == 0 ? programBank[0] : (n6)0x3e); break;
@@ -103,7 +96,18 @@ struct HVC_TxROM : Interface {  //MMC3
       n1 a16 = (address.bit(16) & outerBank.bit(2)) | (outerBank.bit(1) & outerBank.bit(0));
       address = outerBank.bit(2) << 17 | a16 << 16 | (n16)address;
     }
-    return programROM.read(address);
+    return address;
+  }
+
+  auto readPRG(n32 address, n8 data) -> n8 override {
+    if(address < 0x6000) return data;
+
+    if(address < 0x8000) {
+      if(!ramEnable || !programRAM) return data;
+      return programRAM.read((n13)address);
+    }
+
+    return programROM.read(addressPRG(address));
   }
 
   auto writePRG(n32 address, n8 data) -> void override {
@@ -114,6 +118,7 @@ struct HVC_TxROM : Interface {  //MMC3
       if(!ramEnable || !ramWritable) return;
       if(revision == Revision::NESQJ) outerBank = data.bit(0);
       if(revision == Revision::PALZZ) outerBank = data.bit(0,2);
+      if(revision == Revision::NESQJ || revision == Revision::PALZZ) updatePages();
       if(!programRAM) return;
       return programRAM.write((n13)address, data);
     }
@@ -157,6 +162,7 @@ struct HVC_TxROM : Interface {  //MMC3
       irqEnable = 1;
       break;
     }
+    updatePages();
   }
 
   auto addressCHR(n32 address) const -> n32 {
@@ -238,10 +244,19 @@ struct HVC_TxROM : Interface {  //MMC3
     if(characterRAM) return characterRAM.write(addressCHR(address), data);
   }
 
+  //pattern table fetches are snooped for the scanline counter, so only the CPU side is mapped
+  auto updatePages() -> void {
+    if(ramEnable) mapPRG(3, programRAM, 0x0000);
+    else programPage[3] = nullptr;
+    for(u32 page : range(4, 8)) mapPRG(page, programROM, addressPRG(page << 13));
+  }
+
   auto power() -> void override {
+    passiveIO = true;
     outerBank = 0;
     ramEnable = 1;
     ramWritable = 1;
+    updatePages();
   }
 
   auto serialize(serializer& s) -> void override {
@@ -263,6 +278,7 @@ struct HVC_TxROM : Interface {  //MMC3
     s(irqLine);
     s(characterLatch);
     s(characterAddress);
+    updatePages();
   }
 
   n1  characterMode;
@@ -31,20 +31,25 @@ struct HVC_UxROM : Interface {
     Interface::save(characterRAM, "character.ram");
   }
 
-  auto readPRG(n32 address, n8 data) -> n8 override {
-    if(address < 0x8000) return data;
+  auto addressPRG(n32 address) const -> n32 {
     n8 bank;
     switch(address >> 14 & 1) {
     case 0: bank = (revision == Revision::UNROMA ? (n8)0x00 : programBank); break;
     case 1: bank = (revision == Revision::UNROMA ? programBank : (n8)0xff); break;
     }
-    return programROM.read(bank << 14 | (n14)address);
+    return bank << 14 | (n14)address;
+  }
+
+  auto readPRG(n32 address, n8 data) -> n8 override {
+    if(address < 0x8000) return data;
+    return programROM.read(addressPRG(address));
   }
 
   auto writePRG(n32 address, n8 data) -> void override {
     if(address < 0x8000) return;
     programBank = data;
     if(revision == Revision::UN1ROM) programBank >>= 2;
+    updatePages();
   }
 
   auto readCHR(n32 address, n8 data) -> n8 override {
@@ -65,13 +70,24 @@ struct HVC_UxROM : Interface {
     if(characterRAM) return characterRAM.write(address, data);
   }
 
+  auto updatePages() -> void {
+    for(u32 page : range(4, 8)) mapPRG(page, programROM, addressPRG(page << 13));
+    for(u32 page : range(8)) {
+      if(characterROM) mapCHR(page, characterROM, page << 10);
+      else if(characterRAM) mapCHR(page, characterRAM, page << 10);
+    }
+  }
+
   auto power() -> void override {
+    passiveIO = true;
+    updatePages();
   }
 
   auto serialize(serializer& s) -> void override {
     s(characterRAM);
     s(mirror);
     s(programBank);
+    updatePages();
   }
 
   n1 mirror;  //0 = horizontal, 1 = vertical
@@ -2,7 +2,7 @@
 
 namespace ares::Famicom {
 
-Cartridge& cartridge = cartridgeSlot.cartridge;
+instance_local Cartridge& cartridge = cartridgeSlot.cartridge;
 #include "slot.cpp"
 #include "board/board.cpp"
 #include "serialization.cpp"
@@ -54,18 +54,10 @@ auto Cartridge::main() -> void {
   board->main();
 }
 
-auto Cartridge::readPRG(n32 address, n8 data) -> n8 {
-  return board->readPRG(address, data);
-}
-
 auto Cartridge::writePRG(n32 address, n8 data) -> void {
   return board->writePRG(address, data);
 }
 
-auto Cartridge::readCHR(n32 address, n8 data) -> n8 {
-  return board->readCHR(address, data);
-}
-
 auto Cartridge::writeCHR(n32 address, n8 data) -> void {
   return board->writeCHR(address, data);
 }
@@ -29,10 +29,18 @@ struct Cartridge : Thread {
 //privileged:
   unique_pointer<Board::Interface> board;
 
-  auto readPRG(n32 address, n8 data) -> n8;
+  auto readPRG(n32 address, n8 data) -> n8 {
+    if(auto page = board->programPage[address >> 13 & 7]) return page[address & 0x1fff];
+    return board->readPRG(address, data);
+  }
+
   auto writePRG(n32 address, n8 data) -> void;
 
-  auto readCHR(n32 address, n8 data = 0x00) -> n8;
+  auto readCHR(n32 address, n8 data = 0x00) -> n8 {
+    if(address < 0x2000) if(auto page = board->characterPage[address >> 10]) return page[address & 0x03ff];
+    return board->readCHR(address, data);
+  }
+
   auto writeCHR(n32 address, n8 data) -> void;
 
   //scanline() is for debugging purposes only:
@@ -41,4 +49,4 @@ struct Cartridge : Thread {
 };
 
 #include "slot.hpp"
-extern Cartridge& cartridge;
+extern instance_local Cartridge& cartridge;
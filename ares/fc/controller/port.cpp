@@ -1,5 +1,5 @@
-ControllerPort controllerPort1{"Controller Port 1"};
-ControllerPort controllerPort2{"Controller Port 2"};
+instance_local ControllerPort controllerPort1{"Controller Port 1"};
+instance_local ControllerPort controllerPort2{"Controller Port 2"};
 
 ControllerPort::ControllerPort(string name) : name(name) {
 }
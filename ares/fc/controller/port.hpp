@@ -15,5 +15,5 @@ struct ControllerPort {
   const string name;
 };
 
-extern ControllerPort controllerPort1;
-extern ControllerPort controllerPort2;
+extern instance_local ControllerPort controllerPort1;
+extern instance_local ControllerPort controllerPort2;
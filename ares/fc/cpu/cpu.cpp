@@ -2,7 +2,7 @@
 
 namespace ares::Famicom {
 
-CPU cpu;
+instance_local CPU cpu;
 #include "memory.cpp"
 #include "timing.cpp"
 #include "debugger.cpp"
@@ -70,4 +70,4 @@ struct CPU : MOS6502, Thread {
   } io;
 };
 
-extern CPU cpu;
+extern instance_local CPU cpu;
@@ -7,11 +7,11 @@
 //$4018-ffff = Cartridge
 
 inline auto CPU::readBus(n16 address) -> n8 {
-  n8 data = cartridge.readPRG(address, MDR);
+  if(address >= 0x4018) return cartridge.readPRG(address, MDR);
+  if(!cartridge.board->passiveIO) cartridge.readPRG(address, MDR);
   if(address <= 0x1fff) return ram.read(address);
   if(address <= 0x3fff) return ppu.readIO(address);
-  if(address <= 0x4017) return cpu.readIO(address);
-  return data;
+  return cpu.readIO(address);
 }
 
 inline auto CPU::writeBus(n16 address, n8 data) -> void {
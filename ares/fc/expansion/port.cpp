@@ -1,4 +1,4 @@
-ExpansionPort expansionPort{"Expansion Port"};
+instance_local ExpansionPort expansionPort{"Expansion Port"};
 
 ExpansionPort::ExpansionPort(string name) : name(name) {
 }
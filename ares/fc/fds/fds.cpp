@@ -2,7 +2,7 @@
 
 namespace ares::Famicom {
 
-FDS fds;
+instance_local FDS fds;
 #include "drive.cpp"
 #include "timer.cpp"
 #include "audio.cpp"
@@ -54,4 +54,4 @@ private:
   } information;
 };
 
-extern FDS fds;
+extern instance_local FDS fds;
@@ -2,7 +2,7 @@
 
 namespace ares::Famicom {
 
-PPU ppu;
+instance_local PPU ppu;
 #include "memory.cpp"
 #include "render.cpp"
 #include "color.cpp"
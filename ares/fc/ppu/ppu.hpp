@@ -136,4 +136,4 @@ struct PPU : Thread {
   } latch;
 };
 
-extern PPU ppu;
+extern instance_local PPU ppu;
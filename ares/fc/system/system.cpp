@@ -15,9 +15,9 @@ auto load(Node::System& node, string name) -> bool {
   return system.load(node, name);
 }
 
-Random random;
-Scheduler scheduler;
-System system;
+instance_local Random random;
+instance_local Scheduler scheduler;
+instance_local System system;
 #include "controls.cpp"
 #include "serialization.cpp"
 
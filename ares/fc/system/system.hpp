@@ -1,4 +1,4 @@
-extern Random random;
+extern instance_local Random random;
 
 struct System {
   Node::System node;
@@ -43,7 +43,7 @@ private:
   auto serialize(serializer&, bool synchronize) -> void;
 };
 
-extern System system;
+extern instance_local System system;
 
 auto Region::NTSCJ() -> bool { return system.region() == System::Region::NTSCJ; }
 auto Region::NTSCU() -> bool { return system.region() == System::Region::NTSCU; }
@@ -9,7 +9,7 @@ namespace ares::GameBoy {
 #include "wave.cpp"
 #include "noise.cpp"
 #include "serialization.cpp"
-APU apu;
+instance_local APU apu;
 
 auto APU::load(Node::Object parent) -> void {
   node = parent->append<Node::Object>("APU");
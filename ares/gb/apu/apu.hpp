@@ -170,4 +170,4 @@ struct APU : Thread {
   n12 cycle;  //low 12-bits of clock counter
 };
 
-extern APU apu;
+extern instance_local APU apu;
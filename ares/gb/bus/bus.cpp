@@ -2,7 +2,7 @@
 
 namespace ares::GameBoy {
 
-Bus bus;
+instance_local Bus bus;
 
 auto Bus::read(u32 cycle, n16 address, n8 data) -> n8 {
   data &= cpu.readIO(cycle, address, data);
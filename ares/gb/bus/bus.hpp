@@ -6,4 +6,4 @@ struct Bus {
   auto write(n16 address, n8 data) -> void;
 };
 
-extern Bus bus;
+extern instance_local Bus bus;
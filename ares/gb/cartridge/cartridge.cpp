@@ -2,7 +2,7 @@
 #include <nall/bcd.hpp>
 namespace ares::GameBoy {
 
-Cartridge& cartridge = cartridgeSlot.cartridge;
+instance_local Cartridge& cartridge = cartridgeSlot.cartridge;
 #include "board/board.cpp"
 #include "slot.cpp"
 #include "memory.cpp"
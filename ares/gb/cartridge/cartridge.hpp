@@ -36,4 +36,4 @@ struct Cartridge : Thread {
 };
 
 #include "slot.hpp"
-extern Cartridge& cartridge;
+extern instance_local Cartridge& cartridge;
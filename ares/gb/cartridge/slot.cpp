@@ -1,4 +1,4 @@
-CartridgeSlot cartridgeSlot{"Cartridge Slot"};
+instance_local CartridgeSlot cartridgeSlot{"Cartridge Slot"};
 
 CartridgeSlot::CartridgeSlot(string name) : name(name) {
 }
@@ -10,4 +10,4 @@ struct CartridgeSlot {
   const string name;
 };
 
-extern CartridgeSlot cartridgeSlot;
+extern instance_local CartridgeSlot cartridgeSlot;
@@ -10,7 +10,7 @@ namespace ares::GameBoy {
 #include "timing.cpp"
 #include "debugger.cpp"
 #include "serialization.cpp"
-CPU cpu;
+instance_local CPU cpu;
 
 auto CPU::load(Node::Object parent) -> void {
   wram.allocate(!Model::GameBoyColor() ? 8_KiB : 32_KiB);
@@ -49,6 +49,11 @@ auto CPU::load(Node::Object parent) -> void {
     });
   }
 
+  idleLoops = node->append<Node::Setting::Boolean>("Skip Idle Loops", false, [&](auto value) {
+    idleLoop.setEnabled(value && !Model::SuperGameBoy());
+  });
+  idleLoops->setDynamic(true);
+
   debugger.load(node);
 }
 
@@ -57,6 +62,7 @@ auto CPU::unload() -> void {
   hram.reset();
   node = {};
   version = {};
+  idleLoops = {};
   debugger = {};
 }
 
@@ -131,6 +137,7 @@ auto CPU::stoppable() -> bool {
 auto CPU::power() -> void {
   Thread::create(4 * 1024 * 1024, {&CPU::main, this});
   SM83::power();
+  idleLoop.setEnabled(idleLoops->value() && !Model::SuperGameBoy());
 
   for(auto& n : wram) n = 0x00;
   for(auto& n : hram) n = 0x00;
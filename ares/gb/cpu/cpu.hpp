@@ -1,6 +1,7 @@
 struct CPU : SM83, Thread {
   Node::Object node;
   Node::Setting::String version;
+  Node::Setting::Boolean idleLoops;
   Memory::Writable<n8> wram;  //GB = 8KB, GBC = 32KB
   Memory::Writable<n8> hram;
 
@@ -62,6 +63,7 @@ struct CPU : SM83, Thread {
   auto readDMA(n16 address, n8 data) -> n8;
   auto writeDMA(n13 address, n8 data) -> void;
   auto readDebugger(n16 address) -> n8 override;
+  auto idleLoopDetected() -> u32 override;
 
   //timing.cpp
   auto step() -> void;
@@ -145,4 +147,4 @@ struct CPU : SM83, Thread {
   } status;
 };
 
-extern CPU cpu;
+extern instance_local CPU cpu;
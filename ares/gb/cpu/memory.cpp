@@ -32,6 +32,7 @@ auto CPU::idle() -> void {
 
 auto CPU::read(n16 address) -> n8 {
   n8 data = 0xff;
+  if(idleLoop) idleLoop.reading(address);
   if(r.ei) r.ei = 0, r.ime = 1;
   data &= bus.read(0, address, data);
   step();
@@ -47,6 +48,7 @@ auto CPU::read(n16 address) -> n8 {
 }
 
 auto CPU::write(n16 address, n8 data) -> void {
+  if(idleLoop) idleLoop.writing();
   if(r.ei) r.ei = 0, r.ime = 1;
   bus.write(0, address, data);
   step();
@@ -76,3 +78,25 @@ auto CPU::writeDMA(n13 address, n8 data) -> void {
 auto CPU::readDebugger(n16 address) -> n8 {
   return bus.read(address, 0xff);
 }
+
+//SM83 polling loops may only read from WRAM, HRAM and VRAM: every I/O register is left to the interpreter.
+auto CPU::idleLoopDetected() -> u32 {
+  auto peek = [&](u32 address) -> maybe<u32> {
+    if(address >= 0x8000 && address <= 0x9fff) return (u32)bus.read(address, 0xff);  //VRAM
+    if(address >= 0xc000 && address <= 0xdfff) return (u32)bus.read(address, 0xff);  //WRAM
+    if(address >= 0xff80 && address <= 0xfffe) return (u32)bus.read(address, 0xff);  //HRAM
+    return nothing;
+  };
+
+  u32 clocks = idleLoop.elapsed(clock()) / Thread::scalar();
+  if(!clocks || !idleLoop.sample(peek)) return 0;
+  u32 iterations = 0;
+  while(iterations < IdleLoop::Iterations) {
+    step(clocks);
+    iterations++;
+    if(status.interruptFlag & status.interruptEnable || status.hblankPending) break;
+    if(scheduler.synchronizing() || !idleLoop.unchanged(peek)) break;
+  }
+  idleLoop.elapsed(clock());
+  return iterations;
+}
@@ -2,7 +2,7 @@
 
 namespace ares::GameBoy {
 
-PPU ppu;
+instance_local PPU ppu;
 #include "timing.cpp"
 #include "io.cpp"
 #include "dmg.cpp"
@@ -173,4 +173,4 @@ struct PPU : Thread {
   Background window;
 };
 
-extern PPU ppu;
+extern instance_local PPU ppu;
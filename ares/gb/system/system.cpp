@@ -15,9 +15,9 @@ auto load(Node::System& node, string name) -> bool {
   return system.load(node, name);
 }
 
-Scheduler scheduler;
-System system;
-SuperGameBoyInterface* superGameBoy = nullptr;
+instance_local Scheduler scheduler;
+instance_local System system;
+instance_local SuperGameBoyInterface* superGameBoy = nullptr;
 #include "controls.cpp"
 #include "serialization.cpp"
 
@@ -61,8 +61,8 @@ struct System {
   auto serialize(serializer&, bool synchronize) -> void;
 };
 
-extern System system;
-extern SuperGameBoyInterface* superGameBoy;
+extern instance_local System system;
+extern instance_local SuperGameBoyInterface* superGameBoy;
 
 auto Model::GameBoy() -> bool { return system.model() == System::Model::GameBoy; }
 auto Model::GameBoyColor() -> bool { return system.model() == System::Model::GameBoyColor; }
@@ -3,6 +3,7 @@ auto CPU::sleep() -> void {
 }
 
 auto CPU::get(u32 mode, n32 address) -> n32 {
+  if(idleLoop && !(mode & Prefetch)) idleLoop.reading(address);
   u32 clocks = _wait(mode, address);
   u32 word = pipeline.fetch.instruction;
   if(context.dmaActive) word = dmabus.data;
@@ -37,6 +38,7 @@ auto CPU::get(u32 mode, n32 address) -> n32 {
 }
 
 auto CPU::set(u32 mode, n32 address, n32 word) -> void {
+  if(idleLoop) idleLoop.writing();
   u32 clocks = _wait(mode, address);
 
   if(address >= 0x1000'0000) {
@@ -85,3 +87,28 @@ auto CPU::_wait(u32 mode, n32 address) -> u32 {
   if(mode & Word) clocks += s;  //16-bit bus requires two transfers for words
   return clocks;
 }
+
+//ARM7TDMI polling loops are stepped through prefetchStep(), so that the prefetch buffer keeps filling.
+auto CPU::idleLoopDetected() -> u32 {
+  //work RAM, DISPSTAT, VCOUNT, IE and IF can be read without side effects
+  auto peek = [&](u32 address) -> maybe<u32> {
+    if(address >> 24 == 0x02) return (u32)readEWRAM(Word, address);
+    if(address >> 24 == 0x03) return (u32)readIWRAM(Word, address);
+    if((address & ~3) == 0x0400'0004) return (u32)bus.io[address & 0x3ff]->readIO(Word, address);
+    if((address & ~3) == 0x0400'0200) return (u32)bus.io[address & 0x3ff]->readIO(Word, address);
+    return nothing;
+  };
+
+  if(context.dmaActive) return 0;
+  u32 clocks = idleLoop.elapsed(context.clock);
+  if(!clocks || !idleLoop.sample(peek)) return 0;
+  u32 iterations = 0;
+  while(iterations < IdleLoop::Iterations) {
+    prefetchStep(clocks);
+    iterations++;
+    if(irq.ime && (irq.enable & irq.flag)) break;
+    if(scheduler.synchronizing() || !idleLoop.unchanged(peek)) break;
+  }
+  idleLoop.elapsed(context.clock);
+  return iterations;
+}
@@ -19,6 +19,11 @@ auto CPU::load(Node::Object parent) -> void {
 
   node = parent->append<Node::Object>("CPU");
 
+  idleLoops = node->append<Node::Setting::Boolean>("Skip Idle Loops", false, [&](auto value) {
+    idleLoop.setEnabled(value);
+  });
+  idleLoops->setDynamic(true);
+
   debugger.load(node);
 }
 
@@ -26,6 +31,7 @@ auto CPU::unload() -> void {
   iwram.reset();
   ewram.reset();
   node = {};
+  idleLoops = {};
   debugger = {};
 }
 
@@ -88,6 +94,7 @@ auto CPU::step(u32 clocks) -> void {
 
 auto CPU::power() -> void {
   ARM7TDMI::power();
+  idleLoop.setEnabled(idleLoops->value());
   Thread::create(system.frequency(), {&CPU::main, this});
 
   for(auto& byte : iwram) byte = 0x00;
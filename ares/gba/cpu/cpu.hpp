@@ -1,5 +1,6 @@
 struct CPU : ARM7TDMI, Thread, IO {
   Node::Object node;
+  Node::Setting::Boolean idleLoops;
   Memory::Writable<n8> iwram;  // 32KB
   Memory::Writable<n8> ewram;  //256KB
 
@@ -59,6 +60,7 @@ struct CPU : ARM7TDMI, Thread, IO {
   auto sleep() -> void override;
   auto get(u32 mode, n32 address) -> n32 override;
   auto set(u32 mode, n32 address, n32 word) -> void override;
+  auto idleLoopDetected() -> u32 override;
   auto _wait(u32 mode, n32 address) -> u32;
 
   //io.cpp
@@ -0,0 +1,189 @@
+//I/O settings shared by all background layers
+n3 PPU::Background::IO::mode;
+n1 PPU::Background::IO::frame;
+n5 PPU::Background::IO::mosaicWidth;
+n5 PPU::Background::IO::mosaicHeight;
+
+auto PPU::Background::render(u32 y) -> void {
+  for(auto& pixel : line) pixel = {};
+  if(ppu.blank() || !io.enable) {
+    mosaic = {};
+    return;
+  }
+
+  switch(id) {
+  case PPU::BG0:
+    if(io.mode <= 1) { linear(y); break; }
+    break;
+
+  case PPU::BG1:
+    if(io.mode <= 1) { linear(y); break; }
+    break;
+
+  case PPU::BG2:
+    if(io.mode == 0) { linear(y); break; }
+    if(io.mode <= 2) { affine(y); break; }
+    if(io.mode <= 5) { bitmap(y); break; }
+    break;
+
+  case PPU::BG3:
+    if(io.mode == 0) { linear(y); break; }
+    if(io.mode == 2) { affine(y); break; }
+    break;
+  }
+
+  //horizontal mosaic
+  if(!io.mosaic) {
+    mosaic = line[239];
+    return;
+  }
+  u32 mosaicOffset = 0;
+  for(auto& pixel : line) {
+    if(++mosaicOffset > io.mosaicWidth) {
+      mosaicOffset = 0;
+      mosaic = pixel;
+    }
+    pixel = mosaic;
+  }
+  //the latched pixel carries over into the next scanline
+}
+
+auto PPU::Background::linear(u32 y) -> void {
+  if(!io.mosaic || (y % (1 + io.mosaicHeight)) == 0) {
+    vmosaic = y;
+  }
+  u32 fx = io.hoffset;
+  u32 fy = vmosaic + io.voffset;
+
+  n6 ty = fy >> 3;
+  u32 characterBase = io.characterBase << 14;
+
+  //decode one tile row at a time
+  for(u32 x = 0; x < 240;) {
+    n6 tx = fx >> 3;
+
+    u32 offset = (ty & 31) << 5 | (tx & 31);
+    if(io.screenSize.bit(0) && (tx & 32)) offset += 32 << 5;
+    if(io.screenSize.bit(1) && (ty & 32)) offset += 32 << (5 + io.screenSize.bit(0));
+    offset = (io.screenBase << 11) + (offset << 1);
+
+    n16 tilemap = ppu.readVRAM(Half, offset);
+    n10 character = tilemap.bit(0,9);
+    n1  hflip     = tilemap.bit(10);
+    n1  vflip     = tilemap.bit(11);
+    n4  palette   = tilemap.bit(12,15);
+
+    n3 py = fy;
+    if(vflip) py = ~py;
+
+    u8 colors[8];
+    if(io.colorMode == 0) {
+      u32 address = characterBase + (character << 5) + (py << 2);
+      for(u32 n : range(4)) {
+        n8 data = ppu.readVRAM_BG(Byte, address + n);
+        colors[n * 2 + 0] = data & 15;
+        colors[n * 2 + 1] = data >> 4;
+      }
+    } else {
+      u32 address = characterBase + (character << 6) + (py << 3);
+      for(u32 n : range(8)) colors[n] = ppu.readVRAM_BG(Byte, address + n);
+    }
+
+    for(n3 px = fx; x < 240; px++) {
+      if(u8 color = colors[hflip ? 7 - px : (u32)px]) {
+        auto& pixel = line[x];
+        pixel.enable = true;
+        pixel.priority = io.priority;
+        pixel.color = ppu.pram[io.colorMode == 0 ? palette << 4 | color : color];
+      }
+      x++, fx++;
+      if(px == 7) break;
+    }
+  }
+}
+
+auto PPU::Background::affine(u32 y) -> void {
+  if(!io.mosaic || (y % (1 + io.mosaicHeight)) == 0) {
+    hmosaic = io.lx;
+    vmosaic = io.ly;
+  }
+  i28 fx = hmosaic;
+  i28 fy = vmosaic;
+
+  u32 screenSize = 16 << io.screenSize;
+  u32 screenWrap = (1 << (io.affineWrap ? 7 + io.screenSize : 20)) - 1;
+  u32 screenBase = io.screenBase << 11;
+  u32 characterBase = io.characterBase << 14;
+
+  for(auto& pixel : line) {
+    u32 cx = (fx >> 8) & screenWrap;
+    u32 cy = (fy >> 8) & screenWrap;
+
+    u32 tx = cx >> 3;
+    u32 ty = cy >> 3;
+
+    if(tx < screenSize && ty < screenSize) {
+      n8 character = ppu.readVRAM(Byte, screenBase + ty * screenSize + tx);
+      if(n8 color = ppu.readVRAM_BG(Byte, characterBase + (character << 6) + ((cy & 7) << 3) + (cx & 7))) {
+        pixel.enable = true;
+        pixel.priority = io.priority;
+        pixel.color = ppu.pram[color];
+      }
+    }
+
+    fx += io.pa;
+    fy += io.pc;
+  }
+
+  io.lx += io.pb;
+  io.ly += io.pd;
+}
+
+auto PPU::Background::bitmap(u32 y) -> void {
+  if(!io.mosaic || (y % (1 + io.mosaicHeight)) == 0) {
+    hmosaic = io.lx;
+    vmosaic = io.ly;
+  }
+  i28 fx = hmosaic;
+  i28 fy = vmosaic;
+
+  n1  depth = io.mode != 4;  //0 = 8-bit (mode 4); 1 = 15-bit (mode 3, mode 5)
+  u32 width  = io.mode == 5 ? 160 : 240;
+  u32 height = io.mode == 5 ? 128 : 160;
+  u32 mode   = depth ? Half : Byte;
+
+  u32 baseAddress = io.mode == 3 ? 0 : 0xa000 * io.frame;
+
+  for(auto& pixel : line) {
+    u32 px = fx >> 8;
+    u32 py = fy >> 8;
+
+    if(px < width && py < height) {
+      u32 offset = py * width + px;
+      n15 color = ppu.readVRAM_BG(mode, baseAddress + (offset << depth));
+
+      if(depth || color) {  //8bpp color 0 is transparent; 15bpp color is always opaque
+        if(depth == 0) color = ppu.pram[color];
+        pixel.enable = true;
+        pixel.priority = io.priority;
+        pixel.color = color;
+      }
+    }
+
+    fx += io.pa;
+    fy += io.pc;
+  }
+
+  io.lx += io.pb;
+  io.ly += io.pd;
+}
+
+auto PPU::Background::power(u32 id) -> void {
+  this->id = id;
+
+  io = {};
+  hmosaic = 0;
+  vmosaic = 0;
+  mosaic = {};
+  for(auto& pixel : line) pixel = {};
+}
@@ -0,0 +1,100 @@
+auto PPU::DAC::render(u32* output, u32 y) -> void {
+  if(ppu.blank()) {
+    memory::fill<u32>(output, 240, 0x7fff);
+    return;
+  }
+
+  //determine active window for each pixel
+  if(ppu.window0.io.enable || ppu.window1.io.enable || ppu.window2.io.enable) {
+    memory::fill<u8>(active, 240, ppu.window3.mask());
+    if(ppu.window2.io.enable) {
+      u8 mask = ppu.window2.mask();
+      for(u32 x : range(240)) {
+        if(ppu.objects.buffer[x].window) active[x] = mask;
+      }
+    }
+    ppu.window1.render(active, y);
+    ppu.window0.render(active, y);
+  } else {
+    memory::fill<u8>(active, 240, 0x3f);  //enable all layers if no windows are enabled
+  }
+
+  //background priorities are fixed for the entire scanline: sort them once
+  const Pixel* lines[5] = {ppu.objects.line, ppu.bg0.line, ppu.bg1.line, ppu.bg2.line, ppu.bg3.line};
+  u32 priorities[5] = {0, ppu.bg0.io.priority, ppu.bg1.io.priority, ppu.bg2.io.priority, ppu.bg3.io.priority};
+  u32 order[4], count = 0;
+  for(u32 priority : range(4)) {
+    for(u32 layer = BG0; layer <= BG3; layer++) {
+      if(priorities[layer] == priority) order[count++] = layer;
+    }
+  }
+
+  u32 blendAbove = 0, blendBelow = 0;
+  for(u32 layer : range(6)) {
+    blendAbove |= io.blendAbove[layer] << layer;
+    blendBelow |= io.blendBelow[layer] << layer;
+  }
+  auto eva = min(16u, (u32)io.blendEVA);
+  auto evb = min(16u, (u32)io.blendEVB);
+  auto evy = min(16u, (u32)io.blendEVY);
+  n15 backdrop = ppu.pram[0];
+
+  for(u32 x : range(240)) {
+    u32 enabled = active[x];
+
+    //priority sorting: find topmost two pixels
+    //objects are placed above backgrounds of equal priority
+    u32 layer[2] = {SFX, SFX};
+    u32 found = 0;
+    auto& object = lines[OBJ][x];
+    bool objectPending = object.enable && enabled >> OBJ & 1;
+    for(u32 n = 0; n < 4 && found < 2; n++) {
+      u32 id = order[n];
+      if(objectPending && object.priority <= priorities[id]) {
+        layer[found++] = OBJ;
+        objectPending = false;
+        if(found == 2) break;
+      }
+      if(lines[id][x].enable && enabled >> id & 1) layer[found++] = id;
+    }
+    if(objectPending && found < 2) layer[found++] = OBJ;
+
+    n15 aboveColor = layer[0] == SFX ? backdrop : (n15)lines[layer[0]][x].color;
+    n15 belowColor = layer[1] == SFX ? backdrop : (n15)lines[layer[1]][x].color;
+    bool translucent = layer[0] == OBJ && object.translucent;
+    bool above = blendAbove >> layer[0] & 1;
+    bool below = blendBelow >> layer[1] & 1;
+    n15 color = aboveColor;
+
+    //color blending
+    if(enabled >> SFX & 1 || (translucent && below)) {
+      if(translucent && below) {
+        color = blend(aboveColor, eva, belowColor, evb);
+      } else if(io.blendMode == 1 && above && below) {
+        color = blend(aboveColor, eva, belowColor, evb);
+      } else if(io.blendMode == 2 && above) {
+        color = blend(aboveColor, 16 - evy, 0x7fff, evy);
+      } else if(io.blendMode == 3 && above) {
+        color = blend(aboveColor, 16 - evy, 0x0000, evy);
+      }
+    }
+
+    output[x] = color;
+  }
+}
+
+auto PPU::DAC::blend(n15 above, u32 eva, n15 below, u32 evb) const -> n15 {
+  n5 ar = above >> 0, ag = above >> 5, ab = above >> 10;
+  n5 br = below >> 0, bg = below >> 5, bb = below >> 10;
+
+  u32 r = (ar * eva + br * evb) >> 4;
+  u32 g = (ag * eva + bg * evb) >> 4;
+  u32 b = (ab * eva + bb * evb) >> 4;
+
+  return min(31u, r) << 0 | min(31u, g) << 5 | min(31u, b) << 10;
+}
+
+auto PPU::DAC::power() -> void {
+  io = {};
+  memory::fill<u8>(active, 240);
+}
@@ -0,0 +1,25 @@
+//returns the layers enabled inside this window, one bit per layer
+auto PPU::Window::mask() const -> u8 {
+  u8 mask = 0;
+  for(u32 layer : range(6)) mask |= io.active[layer] << layer;
+  return mask;
+}
+
+auto PPU::Window::render(u8* active, u32 y) const -> void {
+  if(!io.enable) return;
+
+  u32 x1 = io.x1, x2 = io.x2;
+  u32 y1 = io.y1, y2 = io.y2;
+
+  if(x2 < x1 || x2 > 240) x2 = 240;
+  if(y2 < y1 || y2 > 160) y2 = 160;
+
+  if(y < y1 || y >= y2 || x1 >= x2) return;
+  memory::fill<u8>(active + x1, x2 - x1, mask());
+}
+
+auto PPU::Window::power(u32 id) -> void {
+  this->id = id;
+
+  io = {};
+}
@@ -1,3 +1,6 @@
+#if 0 //defined(PROFILE_PERFORMANCE)
+#include "../ppu-performance/ppu.cpp"
+#else
 #include <gba/gba.hpp>
 
 //pixel:      4 cycles
@@ -175,3 +178,4 @@ auto PPU::power() -> void {
 }
 
 }
+#endif
@@ -1,3 +1,6 @@
+#if 0 //defined(PROFILE_PERFORMANCE)
+#include "../ppu-performance/ppu.hpp"
+#else
 struct PPU : Thread, IO {
   Node::Object node;
   Node::Video::Screen screen;
@@ -258,3 +261,4 @@ private:
 };
 
 extern PPU ppu;
+#endif
@@ -14,7 +14,7 @@ auto load(Node::System& node, string name) -> bool {
   return system.load(node, name);
 }
 
-Scheduler scheduler;
+instance_local Scheduler scheduler;
 BIOS bios;
 System system;
 #include "bios.cpp"
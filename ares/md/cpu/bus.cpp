@@ -1,10 +1,34 @@
 auto CPU::read(n1 upper, n1 lower, n24 address, n16) -> n16 {
+  if(idleLoop) idleLoop.reading(address);
   while(bus.acquired()) wait(1);
   //using m68k prefetch for open-bus data
   return bus.read(upper, lower, address, r.irc);
 }
 
 auto CPU::write(n1 upper, n1 lower, n24 address, n16 data) -> void {
+  if(idleLoop) idleLoop.writing();
   while(bus.acquired()) wait(1);
   return bus.write(upper, lower, address, data);
 }
+
+//68000 polling loops are only skipped while the Z80 does not hold the bus.
+auto CPU::idleLoopDetected() -> u32 {
+  //reading the VDP or I/O ports has side effects, so only loops polling work RAM are skipped
+  auto peek = [&](u32 address) -> maybe<u32> {
+    if(address < 0xe00000) return nothing;
+    return (u32)ram[address >> 1];
+  };
+
+  if(state.interruptPending || bus.acquired()) return 0;
+  u32 clocks = idleLoop.elapsed(clock()) / Thread::scalar();
+  if(!clocks || !idleLoop.sample(peek)) return 0;
+  u32 iterations = 0;
+  while(iterations < IdleLoop::Iterations) {
+    wait(clocks);
+    iterations++;
+    if(state.interruptPending || bus.acquired()) break;
+    if(scheduler.synchronizing() || !idleLoop.unchanged(peek)) break;
+  }
+  idleLoop.elapsed(clock());
+  return iterations;
+}
@@ -12,6 +12,12 @@ auto CPU::load(Node::Object parent) -> void {
   node = parent->append<Node::Object>("CPU");
   tmss.allocate(2_KiB >> 1);
   ram.allocate(64_KiB >> 1);
+
+  idleLoops = node->append<Node::Setting::Boolean>("Skip Idle Loops", false, [&](auto value) {
+    idleLoop.setEnabled(value);
+  });
+  idleLoops->setDynamic(true);
+
   debugger.load(node);
 
   if(auto fp = system.pak->read("tmss.rom")) {
@@ -20,6 +26,7 @@ auto CPU::load(Node::Object parent) -> void {
 }
 
 auto CPU::unload() -> void {
+  idleLoops = {};
   debugger = {};
   tmss.reset();
   ram.reset();
@@ -89,6 +96,7 @@ auto CPU::lower(Interrupt interrupt) -> bool {
 
 auto CPU::power(bool reset) -> void {
   M68000::power();
+  idleLoop.setEnabled(idleLoops->value());
   Thread::create(system.frequency() / 7.0, {&CPU::main, this});
 
   tmssEnable = system.tmss->value();
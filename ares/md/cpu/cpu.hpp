@@ -2,6 +2,7 @@
 
 struct CPU : M68000, Thread {
   Node::Object node;
+  Node::Setting::Boolean idleLoops;
   Memory::Readable<n16> tmss;
   Memory::Writable<n16> ram;
 
@@ -49,6 +50,7 @@ struct CPU : M68000, Thread {
   //bus.cpp
   auto read(n1 upper, n1 lower, n24 address, n16 _ = 0) -> n16 override;
   auto write(n1 upper, n1 lower, n24 address, n16 data) -> void override;
+  auto idleLoopDetected() -> u32 override;
 
   //io.cpp
   auto readIO(n1 upper, n1 lower, n24 address, n16 data) -> n16;
@@ -40,6 +40,7 @@ struct M32X {
     auto step(u32 clocks) -> void override;
     auto power(bool reset) -> void;
 
+    auto shared(u32 address) -> void;
     auto busReadByte(u32 address) -> u32 override;
     auto busReadWord(u32 address) -> u32 override;
     auto busReadLong(u32 address) -> u32 override;
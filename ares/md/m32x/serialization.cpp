@@ -37,6 +37,9 @@ auto M32X::SH7604::serialize(serializer& s) -> void {
   s(irq.vint.active);
   s(irq.vres.enable);
   s(irq.vres.active);
+  s(cyclesUntilSync);
+  s(cyclesBetweenSyncs);
+  s(sharedAccess);
 }
 
 auto M32X::VDP::serialize(serializer& s) -> void {
@@ -59,7 +59,14 @@ auto M32X::SH7604::step(u32 clocks) -> void {
   cyclesUntilSync -= clocks;
 
   if(cyclesUntilSync <= 0) {
-    cyclesUntilSync = minCyclesBetweenSyncs;
+    //while neither the registers, framebuffer, SDRAM nor uncached memory are touched, the other
+    //processors cannot observe this one, so the slice is doubled up to maxCyclesBetweenSyncs.
+    //pending interrupts keep the shortest slice so that they are taken without extra delay.
+    bool pending = irq.vres.active || irq.vint.active || irq.hint.active || irq.cmd.active || irq.pwm.active;
+    if(sharedAccess || pending) cyclesBetweenSyncs = minCyclesBetweenSyncs;
+    else cyclesBetweenSyncs = min(cyclesBetweenSyncs * 2, maxCyclesBetweenSyncs);
+    sharedAccess = 0;
+    cyclesUntilSync = cyclesBetweenSyncs;
     if(m32x.shm.active()) Thread::synchronize(m32x.shs, cpu);
     if(m32x.shs.active()) Thread::synchronize(m32x.shm, cpu);
   }
@@ -68,12 +75,23 @@ auto M32X::SH7604::step(u32 clocks) -> void {
 auto M32X::SH7604::power(bool reset) -> void {
   Thread::create(23'000'000, {&M32X::SH7604::main, this});
   minCyclesBetweenSyncs = 20;
+  maxCyclesBetweenSyncs = 160;
+  cyclesBetweenSyncs = minCyclesBetweenSyncs;
   SH2::power(reset);
   irq = {};
   irq.vres.enable = 1;
 }
 
+//the 32X registers, the framebuffer and SDRAM are shared with the other SH7604 and the 68000.
+//cached writes are written through and cache misses fill lines from here, so both are counted.
+auto M32X::SH7604::shared(u32 address) -> void {
+  if(address >= 0x0000'4000 && address <= 0x0000'43ff) sharedAccess = 1;
+  if(address >= 0x0400'0000 && address <= 0x0403'ffff) sharedAccess = 1;
+  if(address >= 0x0600'0000 && address <= 0x0603'ffff) sharedAccess = 1;
+}
+
 auto M32X::SH7604::busReadByte(u32 address) -> u32 {
+  shared(address);
   if(address & 1) {
     return m32x.readInternal(0, 1, address & ~1).byte(0);
   } else {
@@ -82,15 +100,18 @@ auto M32X::SH7604::busReadByte(u32 address) -> u32 {
 }
 
 auto M32X::SH7604::busReadWord(u32 address) -> u32 {
+  shared(address);
   return m32x.readInternal(1, 1, address & ~1);
 }
 
 auto M32X::SH7604::busReadLong(u32 address) -> u32 {
+  shared(address);
   u32    data = m32x.readInternal(1, 1, address & ~3 | 0) << 16;
   return data | m32x.readInternal(1, 1, address & ~3 | 2) <<  0;
 }
 
 auto M32X::SH7604::busWriteByte(u32 address, u32 data) -> void {
+  shared(address);
   debugger.tracer.instruction->invalidate(address & ~1);
   if(address & 1) {
     m32x.writeInternal(0, 1, address & ~1, data << 8 | (u8)data << 0);
@@ -100,11 +121,13 @@ auto M32X::SH7604::busWriteByte(u32 address, u32 data) -> void {
 }
 
 auto M32X::SH7604::busWriteWord(u32 address, u32 data) -> void {
+  shared(address);
   debugger.tracer.instruction->invalidate(address & ~1);
   m32x.writeInternal(1, 1, address & ~1, data);
 }
 
 auto M32X::SH7604::busWriteLong(u32 address, u32 data) -> void {
+  shared(address);
   debugger.tracer.instruction->invalidate(address & ~3 | 0);
   debugger.tracer.instruction->invalidate(address & ~3 | 2);
   m32x.writeInternal(1, 1, address & ~3 | 0, data >> 16);
@@ -1,4 +1,4 @@
-static const string SerializerVersion = "v132.3";
+static const string SerializerVersion = "v132.4";
 
 auto System::serialize(bool synchronize) -> serializer {
   if(synchronize) scheduler.enter(Scheduler::Mode::Synchronize);
@@ -29,7 +29,7 @@ auto load(Node::System& node, string name) -> bool {
 }
 
 Random random;
-Scheduler scheduler;
+instance_local Scheduler scheduler;
 System system;
 #include "controls.cpp"
 #include "serialization.cpp"
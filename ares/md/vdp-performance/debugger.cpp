@@ -6,6 +6,8 @@ auto VDP::Debugger::load(Node::Object parent) -> void {
   });
   memory.vram->setWrite([&](u32 address, u8 data) -> void {
     vdp.vram.memory[n15(address >> 1)].byte(!(address & 1)) = data;
+    if(vdp.vram.mode == 0) vdp.vram.decode(address >> 1);
+    if(vdp.vram.mode == 1) vdp.vram.refresh();
   });
 
   memory.vsram = parent->append<Node::Debugger::Memory>("VDP VSRAM");
@@ -208,7 +208,10 @@ auto VDP::writeControlPort(n16 data) -> void {
     dma.io.enable     = data.bit(4);
     irq.vblank.enable = data.bit(5);
     io.displayEnable  = data.bit(6);
-    vram.mode         = data.bit(7);
+    if(vram.mode != data.bit(7)) {
+      vram.mode       = data.bit(7);
+      vram.refresh();
+    }
 
     irq.poll();
     dma.poll();
@@ -16,17 +16,26 @@ auto VDP::VRAM::write(n16 address, n16 data) -> void {
     memory[offset].byte(!address.bit(0)) = data.byte(0);
   }
 
-  n15 offset = address;
-  pixels[offset << 2 | 0] = data >> 12 & 15;
-  pixels[offset << 2 | 1] = data >>  8 & 15;
-  pixels[offset << 2 | 2] = data >>  4 & 15;
-  pixels[offset << 2 | 3] = data >>  0 & 15;
+  decode(address);
 
   if(address < vdp.sprite.io.nametableAddress) return;
   if(address > vdp.sprite.io.nametableAddress + 319) return;
   vdp.sprite.write(address - vdp.sprite.io.nametableAddress, data);
 }
 
+//the tile cache holds each word as the renderer reads it, in both the 64KB and 128KB modes
+auto VDP::VRAM::decode(n15 address) -> void {
+  auto data = read(address);
+  pixels[address << 2 | 0] = data >> 12 & 15;
+  pixels[address << 2 | 1] = data >>  8 & 15;
+  pixels[address << 2 | 2] = data >>  4 & 15;
+  pixels[address << 2 | 3] = data >>  0 & 15;
+}
+
+auto VDP::VRAM::refresh() -> void {
+  for(u32 address : range(32768)) decode(address);
+}
+
 auto VDP::VRAM::readByte(n17 address) const -> n8 {
   return read(address >> 1).byte(!address.bit(0));
 }
@@ -41,33 +41,67 @@ auto VDP::render() -> void {
   state.output = pixels();
   if(!state.output) return;
 
-  for(u32 x : range(screenWidth())) {
-    Pixel g = {io.backgroundColor, 0, 1};
-    Pixel a = planeA.pixels[x];
-    Pixel b = planeB.pixels[x];
-    Pixel s = sprite.pixels[x];
-
-    auto& bg = a.above() || a.color && !b.above() ? a : b.color ? b : g;
-    auto& fg = s.above() || s.color && !b.above() && !a.above() ? s : bg;
-
-    if(!io.shadowHighlightEnable) {
-      auto color = cram.read(fg.color);
-      outputPixel(fg.backdrop << 11 | 1 << 9 | color);
-    } else {
-      u32 mode = a.priority || b.priority;  //0 = shadow, 1 = normal, 2 = highlight
-
-      if(&fg == &s) switch(s.color) {
-      case 0x0e:
-      case 0x1e:
-      case 0x2e: mode  = 1; break;
-      case 0x3e: mode += 1; fg = bg; break;
-      case 0x3f: mode  = 0; fg = bg; break;
-      default:   mode |= s.priority; break;
+  u32 width = screenWidth();
+  u8 backdrop = Pixel::Backdrop | io.backgroundColor;
+
+  if(!io.shadowHighlightEnable) {
+    //select the topmost layer for every pixel of the scanline.
+    //this operates on packed bytes without branches, so that it can be vectorized.
+    u8 line[320];
+    for(u32 x : range(width)) {
+      u8 a = planeA.pixels[x];
+      u8 b = planeB.pixels[x];
+      u8 s = sprite.pixels[x];
+
+      bool aAbove = Pixel::above(a);
+      bool bAbove = Pixel::above(b);
+      bool sAbove = Pixel::above(s);
+
+      u8 bg = aAbove || a & Pixel::Color && !bAbove ? a : b & Pixel::Color ? b : backdrop;
+      line[x] = sAbove || s & Pixel::Color && !bAbove && !aAbove ? s : bg;
+    }
+
+    u32 colors[64];
+    for(u32 n : range(64)) colors[n] = 1 << 9 | cram.read(n);
+
+    auto output = [&](auto pixelWidth) {
+      for(u32 x : range(width)) {
+        u32 color = line[x] >> 7 << 11 | colors[line[x] & Pixel::Color];
+        for(u32 n : range(pixelWidth)) state.output[n] = color;
+        state.output += pixelWidth;
       }
+    };
+    if(pixelWidth() == 4) output(std::integral_constant<u32, 4>{});
+    if(pixelWidth() == 5) output(std::integral_constant<u32, 5>{});
+    return;
+  }
+
+  for(u32 x : range(width)) {
+    u8 a = planeA.pixels[x];
+    u8 b = planeB.pixels[x];
+    u8 s = sprite.pixels[x];
+
+    bool aAbove = Pixel::above(a);
+    bool bAbove = Pixel::above(b);
+    bool sAbove = Pixel::above(s);
 
-      auto color = cram.read(fg.color);
-      outputPixel(fg.backdrop << 11 | mode << 9 | color);
+    u8 bg = aAbove || a & Pixel::Color && !bAbove ? a : b & Pixel::Color ? b : backdrop;
+    bool foreground = sAbove || s & Pixel::Color && !bAbove && !aAbove;
+    u8 fg = foreground ? s : bg;
+
+    u32 mode = (a | b) >> 6 & 1;  //0 = shadow, 1 = normal, 2 = highlight
+
+    if(foreground) switch(s & Pixel::Color) {
+    case 0x0e:
+    case 0x1e:
+    case 0x2e: mode  = 1; break;
+    case 0x3e: mode += 1; fg = bg; break;
+    case 0x3f: mode  = 0; fg = bg; break;
+    default:   mode |= s >> 6; break;
     }
+
+    auto color = cram.read(fg & Pixel::Color);
+    outputPixel(fg >> 7 << 11 | mode << 9 | color);
   }
 }
 
@@ -65,10 +65,11 @@ auto VDP::IRQ::serialize(serializer& s) -> void {
 }
 
 auto VDP::VRAM::serialize(serializer& s) -> void {
-  s(pixels);
   s(memory);
   s(size);
   s(mode);
+
+  if(s.reading()) refresh();
 }
 
 auto VDP::VSRAM::serialize(serializer& s) -> void {
@@ -147,6 +147,8 @@ private:
     //memory.cpp
     auto read(n16 address) const -> n16;
     auto write(n16 address, n16 data) -> void;
+    auto decode(n15 address) -> void;
+    auto refresh() -> void;
 
     auto readByte(n17 address) const -> n8;
     auto writeByte(n17 address, n8 data) -> void;
@@ -154,10 +156,12 @@ private:
     //serialization.cpp
     auto serialize(serializer&) -> void;
 
-    n8  pixels[131072];
     n16 memory[65536];
     n32 size = 32768;
     n1  mode;  //0 = 64KB, 1 = 128KB
+
+  //unserialized:
+    u8  pixels[131072];  //decoded tile cache: one 4bpp pixel per byte, updated on every write
   } vram;
 
   struct VSRAM {
@@ -188,13 +192,13 @@ private:
     n9 memory[64];
   } cram;
 
+  //layer pixels are packed into bytes so that a scanline can be composed in bulk
   struct Pixel {
-    auto above() const -> bool { return priority == 1 && color; }
-    auto below() const -> bool { return priority == 0 && color; }
+    static constexpr u8 Color    = 0x3f;
+    static constexpr u8 Priority = 0x40;
+    static constexpr u8 Backdrop = 0x80;
 
-    n6 color;
-    n1 priority;
-    n1 backdrop;
+    static auto above(u8 pixel) -> bool { return pixel > Priority; }  //priority == 1 && color
   };
 
   struct Background {
@@ -226,7 +230,7 @@ private:
     } io;
 
   //unserialized:
-    Pixel pixels[320];
+    u8 pixels[320];
   };
   Background planeA{Background::ID::PlaneA};
   Background window{Background::ID::Window};
@@ -275,7 +279,7 @@ private:
     Object objects[20];
 
   //unserialized:
-    Pixel pixels[512];
+    u8 pixels[512];
   } sprite{*this};
 
   struct Command {
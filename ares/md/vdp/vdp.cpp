@@ -1,4 +1,4 @@
-#if 0 //defined(PROFILE_PERFORMANCE)
+#if defined(MD_VDP_PERFORMANCE)
 #include "../vdp-performance/vdp.cpp"
 #else
 #include <md/md.hpp>
@@ -1,5 +1,5 @@
 //Yamaha YM7101
-#if 0 //defined(PROFILE_PERFORMANCE)
+#if defined(MD_VDP_PERFORMANCE)
 #include "../vdp-performance/vdp.hpp"
 #else
 struct VDP : Thread {
@@ -2,7 +2,7 @@
 
 namespace ares::MasterSystem {
 
-Cartridge& cartridge = cartridgeSlot.cartridge;
+instance_local Cartridge& cartridge = cartridgeSlot.cartridge;
 #include "board/board.cpp"
 #include "slot.cpp"
 #include "serialization.cpp"
@@ -33,4 +33,4 @@ struct Cartridge {
 };
 
 #include "slot.hpp"
-extern Cartridge& cartridge;
+extern instance_local Cartridge& cartridge;
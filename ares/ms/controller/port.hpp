@@ -29,5 +29,5 @@ struct ControllerPort {
   n1 thLevel;
 };
 
-extern ControllerPort controllerPort1;
-extern ControllerPort controllerPort2;
+extern instance_local ControllerPort controllerPort1;
+extern instance_local ControllerPort controllerPort2;
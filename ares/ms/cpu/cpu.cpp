@@ -2,7 +2,7 @@
 
 namespace ares::MasterSystem {
 
-CPU cpu;
+instance_local CPU cpu;
 #include "memory.cpp"
 #include "debugger.cpp"
 #include "serialization.cpp"
@@ -12,12 +12,18 @@ auto CPU::load(Node::Object parent) -> void {
 
   node = parent->append<Node::Object>("CPU");
 
+  idleLoops = node->append<Node::Setting::Boolean>("Skip Idle Loops", false, [&](auto value) {
+    idleLoop.setEnabled(value);
+  });
+  idleLoops->setDynamic(true);
+
   debugger.load(node);
 }
 
 auto CPU::unload() -> void {
   ram.reset();
   node = {};
+  idleLoops = {};
   debugger = {};
 }
 
@@ -45,6 +51,35 @@ auto CPU::step(u32 clocks) -> void {
   Thread::synchronize();
 }
 
+//Z80 polling loops usually wait on the V counter, or on a RAM flag set by an interrupt handler.
+auto CPU::idleLoopDetected() -> u32 {
+  auto peek = [&](u32 address) -> maybe<u32> {
+    if(address >> 16) {
+      //only the counters can be read without side effects
+      if((address & 0xc1) == 0x40) return (u32)vdp.vcounterQuery();
+      if((address & 0xc1) == 0x41) return (u32)vdp.hcounterQuery();
+      return nothing;
+    }
+    if(address < 0xc000) return nothing;  //cartridge mappers may observe reads
+    n8 mdr = bus.mdr;
+    n8 data = read(address);
+    bus.mdr = mdr;
+    return (u32)data;
+  };
+
+  u32 clocks = idleLoop.elapsed(clock()) / Thread::scalar();
+  if(!clocks || !idleLoop.sample(peek)) return 0;
+  u32 iterations = 0;
+  while(iterations < IdleLoop::Iterations) {
+    step(clocks);
+    iterations++;
+    if(state.nmiLine || state.irqLine) break;
+    if(scheduler.synchronizing() || !idleLoop.unchanged(peek)) break;
+  }
+  idleLoop.elapsed(clock());
+  return iterations;
+}
+
 auto CPU::setNMI(bool value) -> void {
   state.nmiLine = value;
 }
@@ -56,6 +91,7 @@ auto CPU::setIRQ(bool value) -> void {
 auto CPU::power() -> void {
   Z80::bus = this;
   Z80::power();
+  idleLoop.setEnabled(idleLoops->value());
   Thread::create(system.colorburst(), {&CPU::main, this});
   PC = 0x0000;  //reset vector address
   SP = 0xfffd;  //initial stack pointer location
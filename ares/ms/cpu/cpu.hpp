@@ -1,5 +1,6 @@
 struct CPU : Z80, Z80::Bus, Thread {
   Node::Object node;
+  Node::Setting::Boolean idleLoops;
   Memory::Writable<n8> ram;  //8KB
 
   struct Debugger {
@@ -29,6 +30,7 @@ struct CPU : Z80, Z80::Bus, Thread {
 
   auto main() -> void;
   auto step(u32 clocks) -> void override;
+  auto idleLoopDetected() -> u32 override;
 
   auto setNMI(bool value) -> void;
   auto setIRQ(bool value) -> void;
@@ -80,4 +82,4 @@ private:
   } sio;
 };
 
-extern CPU cpu;
+extern instance_local CPU cpu;
@@ -14,4 +14,4 @@ struct ExpansionPort {
   const string name;
 };
 
-extern ExpansionPort expansionPort;
+extern instance_local ExpansionPort expansionPort;
@@ -2,7 +2,7 @@
 
 namespace ares::MasterSystem {
 
-OPLL opll;
+instance_local OPLL opll;
 #include "serialization.cpp"
 
 auto OPLL::load(Node::Object parent) -> void {
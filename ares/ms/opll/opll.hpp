@@ -18,4 +18,4 @@ struct OPLL : YM2413, Thread {
   } io;
 };
 
-extern OPLL opll;
+extern instance_local OPLL opll;
@@ -2,7 +2,7 @@
 
 namespace ares::MasterSystem {
 
-PSG psg;
+instance_local PSG psg;
 #include "serialization.cpp"
 
 auto PSG::load(Node::Object parent) -> void {
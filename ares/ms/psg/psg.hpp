@@ -23,4 +23,4 @@ struct PSG : SN76489, Thread {
   f64 volume[16];
 };
 
-extern PSG psg;
+extern instance_local PSG psg;
@@ -20,9 +20,9 @@ auto load(Node::System& node, string name) -> bool {
   return system.load(node, name);
 }
 
-Scheduler scheduler;
-BIOS bios;
-System system;
+instance_local Scheduler scheduler;
+instance_local BIOS bios;
+instance_local System system;
 #include "bios.cpp"
 #include "controls.cpp"
 #include "serialization.cpp"
@@ -81,8 +81,8 @@ private:
   auto serialize(serializer&, bool synchronize) -> void;
 };
 
-extern BIOS bios;
-extern System system;
+extern instance_local BIOS bios;
+extern instance_local System system;
 
 auto Model::MarkIII() -> bool { return system.model() == System::Model::MarkIII; }
 auto Model::MasterSystemI() -> bool { return system.model() == System::Model::MasterSystemI; }
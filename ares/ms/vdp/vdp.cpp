@@ -2,7 +2,7 @@
 
 namespace ares::MasterSystem {
 
-VDP vdp;
+instance_local VDP vdp;
 #include "io.cpp"
 #include "irq.cpp"
 #include "background.cpp"
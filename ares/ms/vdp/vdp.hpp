@@ -206,4 +206,4 @@ private:
   } latch;
 };
 
-extern VDP vdp;
+extern instance_local VDP vdp;
@@ -16,7 +16,7 @@ auto load(Node::System& node, string name) -> bool {
   return system.load(node, name);
 }
 
-Scheduler scheduler;
+instance_local Scheduler scheduler;
 ROM rom;
 System system;
 #include "serialization.cpp"
@@ -42,16 +42,23 @@ auto CPU::synchronize() -> void {
   auto clocks = Thread::clock * 2;
   Thread::clock = 0;
 
-   vi.clock -= clocks;
-   ai.clock -= clocks;
-  rsp.clock -= clocks;
-  rdp.clock -= clocks;
-  pif.clock -= clocks;
-  while( vi.clock < 0)  vi.main();
-  while( ai.clock < 0)  ai.main();
-  while(rsp.clock < 0) rsp.main();
-  while(rdp.clock < 0) rdp.main();
-  while(pif.clock < 0) pif.main();
+  units.counters.blocks++;
+  units.pending += clocks;
+  if(units.pending > units.deadline) {
+    units.counters.wakeups++;
+     vi.clock -= units.pending;
+     ai.clock -= units.pending;
+    rsp.clock -= units.pending;
+    rdp.clock -= units.pending;
+    pif.clock -= units.pending;
+    while( vi.clock < 0)  vi.main(), units.counters.vi++;
+    while( ai.clock < 0)  ai.main(), units.counters.ai++;
+    while(rsp.clock < 0) rsp.main(), units.counters.rsp++;
+    while(rdp.clock < 0) rdp.main(), units.counters.rdp++;
+    while(pif.clock < 0) pif.main(), units.counters.pif++;
+    units.pending = 0;
+    units.deadline = min(min(vi.clock, ai.clock), min(min(rsp.clock, rdp.clock), pif.clock));
+  }
 
   queue.step(clocks, [](u32 event) {
     switch(event) {
@@ -132,6 +139,7 @@ auto CPU::instructionEpilogue() -> s32 {
 
 auto CPU::power(bool reset) -> void {
   Thread::reset();
+  units = {};
 
   pipeline = {};
   branch = {};
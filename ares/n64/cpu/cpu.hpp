@@ -20,12 +20,18 @@ struct CPU : Thread {
     auto tlbStoreInvalid(u64 address) -> void;
     auto tlbStoreMiss(u64 address) -> void;
 
+    auto units() -> string;
+
     struct Tracer {
       Node::Debugger::Tracer::Instruction instruction;
       Node::Debugger::Tracer::Notification exception;
       Node::Debugger::Tracer::Notification interrupt;
       Node::Debugger::Tracer::Notification tlb;
     } tracer;
+
+    struct Properties {
+      Node::Debugger::Properties units;
+    } properties;
   } debugger;
 
   //cpu.cpp
@@ -77,6 +83,22 @@ struct CPU : Thread {
     u32 state = Step;
   } branch;
 
+  //the other units are run from synchronize(), but only once the earliest of them is due
+  struct Units {
+    s64 pending = 0;   //clocks elapsed since the units were last run
+    s64 deadline = 0;  //clocks until the earliest unit is due
+
+    struct Counters {
+      u64 blocks = 0;   //calls to synchronize()
+      u64 wakeups = 0;  //calls that found a unit due
+      u64 vi = 0;
+      u64 ai = 0;
+      u64 rsp = 0;
+      u64 rdp = 0;
+      u64 pif = 0;
+    } counters;
+  } units;
+
   //context.cpp
   struct Context {
     CPU& self;
@@ -6,6 +6,9 @@ auto CPU::Debugger::load(Node::Object parent) -> void {
   tracer.exception = parent->append<Node::Debugger::Tracer::Notification>("Exception", "CPU");
   tracer.interrupt = parent->append<Node::Debugger::Tracer::Notification>("Interrupt", "CPU");
   tracer.tlb = parent->append<Node::Debugger::Tracer::Notification>("TLB", "CPU");
+
+  properties.units = parent->append<Node::Debugger::Properties>("Units");
+  properties.units->setQuery([&] { return units(); });
 }
 
 auto CPU::Debugger::unload() -> void {
@@ -13,6 +16,7 @@ auto CPU::Debugger::unload() -> void {
   tracer.exception.reset();
   tracer.interrupt.reset();
   tracer.tlb.reset();
+  properties.units.reset();
 }
 
 auto CPU::Debugger::instruction() -> void {
@@ -20,6 +24,11 @@ auto CPU::Debugger::instruction() -> void {
     u64 address = cpu.pipeline.address;
     u32 instruction = cpu.pipeline.instruction;
     if(tracer.instruction->address(address)) {
+      if(tracer.instruction->binary()) {
+        tracer.instruction->record(instruction);
+        for(u32 index : range(32)) tracer.instruction->record(index, cpu.ipu.r[index].u64);
+        return;
+      }
       cpu.disassembler.showColors = 0;
       tracer.instruction->notify(cpu.disassembler.disassemble(address, instruction), {});
       cpu.disassembler.showColors = 1;
@@ -130,3 +139,16 @@ auto CPU::Debugger::tlbStoreMiss(u64 address) -> void {
     tracer.tlb->notify({"store miss: 0x", hex(address)});
   }
 }
+
+auto CPU::Debugger::units() -> string {
+  auto& counters = cpu.units.counters;
+  string output;
+  output.append("Blocks:  ", counters.blocks, "\n");
+  output.append("Wakeups: ", counters.wakeups, "\n");
+  output.append("VI:      ", counters.vi, "\n");
+  output.append("AI:      ", counters.ai, "\n");
+  output.append("RSP:     ", counters.rsp, "\n");
+  output.append("RDP:     ", counters.rdp, "\n");
+  output.append("PIF:     ", counters.pif, "\n");
+  return output;
+}
@@ -1,6 +1,9 @@
 auto CPU::serialize(serializer& s) -> void {
   Thread::serialize(s);
 
+  s(units.pending);
+  s(units.deadline);
+
   s(pipeline.address);
   s(pipeline.instruction);
 
@@ -67,19 +67,26 @@ auto RSP::Recompiler::emit(u12 address) -> Block* {
   }
 
   auto block = (Block*)allocator.acquire(sizeof(Block));
-  beginFunction(3);
+  beginFunction(3, 3, true);
+  vectorReset();
 
   u12 start = address;
   bool hasBranched = 0;
   while(true) {
     u32 instruction = self.imem.read<Word>(address);
+    called = false;
     bool branched = emitEXECUTE(instruction);
-    call(&RSP::instructionEpilogue);
+    //the branch state is only known to be Step between two non-branching instructions,
+    //and only instructions that call into the emulator can halt the RSP
+    bool inlined = address != start && !hasBranched && !branched && !called;
+    if(inlined) emitEpilogue();
+    if(!inlined) call(&RSP::instructionEpilogue);
     address += 4;
     if(hasBranched || address == start) break;
     hasBranched = branched;
-    testJumpEpilog();
+    if(!inlined) testJumpEpilog();
   }
+  vectorRelease();
   jumpEpilog();
 
   memory::jitprotect(false);
@@ -106,6 +113,7 @@ auto RSP::Recompiler::emit(u12 address) -> Block* {
 #define i16 s16(instruction)
 #define n16 u16(instruction)
 #define n26 u32(instruction & 0x03ff'ffff)
+#define Field(f) mem(sreg(0), (u8*)&self.f - (u8*)&self)
 #define callvu(name) \
   switch(E) { \
   case 0x0: call(name<0x0>); break; \
@@ -667,6 +675,8 @@ auto RSP::Recompiler::emitVU(u32 instruction) -> bool {
   }
   #undef E
 
+  if(emitVUSIMD(instruction)) return 0;
+
   #define E  (instruction >> 21 & 15)
   #define DE (instruction >> 11 &  7)
   switch(instruction & 0x3f) {
@@ -1137,7 +1147,467 @@ auto RSP::Recompiler::emitVU(u32 instruction) -> bool {
   return 0;
 }
 
+//performs the bookkeeping of RSP::instructionEpilogue() for instructions that continue to the next one
+auto RSP::Recompiler::emitEpilogue() -> void {
+  add64(Field(Thread::clock), Field(Thread::clock), imm(3));
+  mov32(mem(sreg(1), offsetof(IPU, r)), imm(0));
+  mov32_u16(reg(0), mem(sreg(1), offsetof(IPU, pc)));
+  add32(reg(0), reg(0), imm(4));
+  mov32_u16(mem(sreg(1), offsetof(IPU, pc)), reg(0));
+}
+
+auto RSP::Recompiler::vectorReset() -> void {
+  for(u32 slot : range(Vectors::Slots)) {
+    vectors.offset[slot] = ~0;
+    vectors.dirty[slot] = false;
+    vectors.used[slot] = 0;
+  }
+  vectors.counter = 0;
+}
+
+//returns the slot holding the VU member at offset, assigning the least recently used slot if none does
+auto RSP::Recompiler::vectorSlot(u32 offset, bool load) -> u32 {
+  u32 slot = 0;
+  for(u32 index : range(Vectors::Slots)) {
+    if(vectors.offset[index] == offset) {
+      vectors.used[index] = ++vectors.counter;
+      return index;
+    }
+    if(vectors.used[index] < vectors.used[slot]) slot = index;
+  }
+  #if defined(ARCHITECTURE_AMD64)
+  if(vectors.dirty[slot]) movdqu(sreg(2), vectors.offset[slot], xmm(6 + slot));
+  if(load) movdqu(xmm(6 + slot), sreg(2), offset);
+  #endif
+  vectors.offset[slot] = offset;
+  vectors.dirty[slot] = false;
+  vectors.used[slot] = ++vectors.counter;
+  return slot;
+}
+
+//writes back modified VU registers, which remain held
+auto RSP::Recompiler::vectorSave() -> void {
+  #if defined(ARCHITECTURE_AMD64)
+  for(u32 slot : range(Vectors::Slots)) {
+    if(vectors.dirty[slot]) movdqu(sreg(2), vectors.offset[slot], xmm(6 + slot));
+  }
+  #endif
+}
+
+//reloads all held VU registers after a call has clobbered the host vector registers
+auto RSP::Recompiler::vectorRestore() -> void {
+  #if defined(ARCHITECTURE_AMD64)
+  for(u32 slot : range(Vectors::Slots)) {
+    if(vectors.offset[slot] != ~0u) movdqu(xmm(6 + slot), sreg(2), vectors.offset[slot]);
+  }
+  #endif
+}
+
+auto RSP::Recompiler::vectorRelease() -> void {
+  vectorSave();
+  vectorReset();
+}
+
+#if defined(ARCHITECTURE_AMD64)
+auto RSP::Recompiler::vector(u32 offset) -> xmm {
+  return xmm(6 + vectorSlot(offset, true));
+}
+
+//for members that are about to be overwritten in full
+auto RSP::Recompiler::vectorWrite(u32 offset) -> xmm {
+  u32 slot = vectorSlot(offset, false);
+  vectors.dirty[slot] = true;
+  return xmm(6 + slot);
+}
+#endif
+
+//LQV/SQV and LDV/SDV move vectors between DMEM and the held VU registers inline, when the element
+//selects a whole (LQV/SQV) or half (LDV/SDV) vector and the address turns out to be aligned.
+//all other accesses call the interpreter, around which the held VU registers are saved and restored.
+auto RSP::Recompiler::emitLoadSIMD(u32 instruction) -> bool {
+#if defined(ARCHITECTURE_AMD64) && ARCHITECTURE_SUPPORTS_SSE4_1
+  if constexpr(Accuracy::RSP::SIMD) {
+  #define E  (instruction >> 7 & 15)
+  #define i7 (s8(instruction << 1) >> 1)
+  #define VT offsetof(VU, r) + Vtn * sizeof(r128)
+  u32 op = instruction >> 11 & 0x1f;
+  //LDV Vt(e),Rs,i7
+  if(op == 0x03 && (E == 0 || E == 8)) {
+    vector(VT);
+    auto slow = emitAddressSIMD(instruction, 8);
+    movq(xmm(0), reg(0), 0);
+    pshufd(xmm(0), xmm(0), E ? 0x01 : 0x10);
+    pblendw(vectorWrite(VT), xmm(0), E ? 0x0f : 0xf0);
+    auto fast = jump();
+    setLabel(slow);
+    vectorSave();
+    lea(reg(1), Vt);
+    lea(reg(2), Rs);
+    mov32(reg(3), imm(i7));
+    generic::call(E ? &RSP::LDV<8> : &RSP::LDV<0>);
+    vectorRestore();
+    setLabel(fast);
+    return 1;
+  }
+  //LQV Vt(e),Rs,i7
+  if(op == 0x04 && E == 0) {
+    vector(VT);
+    auto slow = emitAddressSIMD(instruction, 16);
+    movdqu(xmm(0), reg(0), 0);
+    pshufd(vectorWrite(VT), xmm(0), 0x1b);
+    auto fast = jump();
+    setLabel(slow);
+    vectorSave();
+    lea(reg(1), Vt);
+    lea(reg(2), Rs);
+    mov32(reg(3), imm(i7));
+    generic::call(&RSP::LQV<0>);
+    vectorRestore();
+    setLabel(fast);
+    return 1;
+  }
+  #undef E
+  #undef i7
+  #undef VT
+  }
+#endif
+  return 0;
+}
+
+auto RSP::Recompiler::emitStoreSIMD(u32 instruction) -> bool {
+#if defined(ARCHITECTURE_AMD64) && ARCHITECTURE_SUPPORTS_SSE4_1
+  if constexpr(Accuracy::RSP::SIMD) {
+  #define E  (instruction >> 7 & 15)
+  #define i7 (s8(instruction << 1) >> 1)
+  #define VT offsetof(VU, r) + Vtn * sizeof(r128)
+  u32 op = instruction >> 11 & 0x1f;
+  //SDV Vt(e),Rs,i7
+  if(op == 0x03 && (E == 0 || E == 8)) {
+    auto vt = vector(VT);
+    auto slow = emitAddressSIMD(instruction, 8);
+    pshufd(xmm(0), vt, E ? 0x01 : 0x0b);
+    movq(reg(0), 0, xmm(0));
+    auto fast = jump();
+    setLabel(slow);
+    vectorSave();
+    lea(reg(1), Vt);
+    lea(reg(2), Rs);
+    mov32(reg(3), imm(i7));
+    generic::call(E ? &RSP::SDV<8> : &RSP::SDV<0>);
+    vectorRestore();
+    setLabel(fast);
+    return 1;
+  }
+  //SQV Vt(e),Rs,i7
+  if(op == 0x04 && E == 0) {
+    auto vt = vector(VT);
+    auto slow = emitAddressSIMD(instruction, 16);
+    pshufd(xmm(0), vt, 0x1b);
+    movdqu(reg(0), 0, xmm(0));
+    auto fast = jump();
+    setLabel(slow);
+    vectorSave();
+    lea(reg(1), Vt);
+    lea(reg(2), Rs);
+    mov32(reg(3), imm(i7));
+    generic::call(&RSP::SQV<0>);
+    vectorRestore();
+    setLabel(fast);
+    return 1;
+  }
+  #undef E
+  #undef i7
+  #undef VT
+  }
+#endif
+  return 0;
+}
+
+//leaves a pointer to the DMEM bytes of a vector access in reg(0), or branches to the returned jump when
+//the address is not a multiple of size. DMEM holds words in host order, which pshufd reverses.
+auto RSP::Recompiler::emitAddressSIMD(u32 instruction, u32 size) -> sljit_jump* {
+  s32 offset = s8(instruction << 1) >> 1;
+  mov32(reg(1), mem(Rs));
+  add32(reg(1), reg(1), imm(offset * size));
+  test32(reg(1), imm(size - 1), set_z);
+  auto slow = jump(flag_nz);
+  and32(reg(1), reg(1), imm(0xfff));
+  mov64_u32(reg(1), reg(1));
+  mov64(reg(0), Field(dmem.data));
+  add64(reg(0), reg(0), reg(1));
+  return slow;
+}
+
+//emits the most common VU computational instructions inline as SSE sequences,
+//rather than calling into the SIMD interpreter. these mirror interpreter-vpu.cpp exactly.
+//operands are copied out of the held VU registers into xmm0-xmm5 before being modified.
+//returns false when the instruction must be handled by the interpreter instead.
+auto RSP::Recompiler::emitVUSIMD(u32 instruction) -> bool {
+#if defined(ARCHITECTURE_AMD64) && ARCHITECTURE_SUPPORTS_SSE4_1
+  if constexpr(Accuracy::RSP::SIMD) {
+  #define E    (instruction >> 21 & 15)
+  #define ACCH offsetof(VU, acch)
+  #define ACCM offsetof(VU, accm)
+  #define ACCL offsetof(VU, accl)
+  #define VCOH offsetof(VU, vcoh)
+  #define VCOL offsetof(VU, vcol)
+  #define VD   offsetof(VU, r) + Vdn * sizeof(r128)
+  #define VS   offsetof(VU, r) + Vsn * sizeof(r128)
+  #define VT   offsetof(VU, r) + Vtn * sizeof(r128)
+  auto operands = [&] {
+    movdqa(xmm(0), vector(VS));
+    movdqa(xmm(1), vector(VT));
+    if(E >= 2) {
+      mov64(reg(0), imm((sljit_sw)&shuffle[E]));
+      movdqu(xmm(2), reg(0), 0);
+      pshufb(xmm(1), xmm(2));
+    }
+  };
+  auto invert = [&](xmm x) {
+    pcmpeqw(xmm(5), xmm(5));
+    pxor(x, xmm(5));
+  };
+
+  switch(instruction & 0x3f) {
+
+  //VMULF Vd,Vs,Vt(e)
+  case 0x00: {
+    operands();
+    movdqa(xmm(2), xmm(0));
+    pmullw(xmm(2), xmm(1));      //lo
+    movdqa(xmm(3), xmm(0));
+    pmulhw(xmm(3), xmm(1));      //hi
+    pcmpeqw(xmm(0), xmm(1));     //neq
+    movdqa(xmm(4), xmm(2));
+    psrlw(xmm(4), 15);           //sign1
+    paddw(xmm(2), xmm(2));
+    movdqa(xmm(5), xmm(2));
+    psrlw(xmm(5), 15);           //sign2
+    paddw(xmm(4), xmm(5));
+    pcmpeqw(xmm(5), xmm(5));
+    psllw(xmm(5), 15);           //round
+    paddw(xmm(5), xmm(2));
+    movdqa(vectorWrite(ACCL), xmm(5));
+    psllw(xmm(3), 1);
+    paddw(xmm(3), xmm(4));
+    movdqa(vectorWrite(ACCM), xmm(3));
+    movdqa(xmm(4), xmm(3));
+    psraw(xmm(4), 15);           //neg
+    movdqa(xmm(1), xmm(0));
+    pandn(xmm(1), xmm(4));
+    movdqa(vectorWrite(ACCH), xmm(1));
+    pand(xmm(0), xmm(4));        //eq
+    paddw(xmm(0), xmm(3));
+    movdqa(vectorWrite(VD), xmm(0));
+    return 1;
+  }
+
+  //VMUDH Vd,Vs,Vt(e)
+  case 0x07: {
+    operands();
+    movdqa(xmm(2), xmm(0));
+    pmullw(xmm(2), xmm(1));
+    pmulhw(xmm(0), xmm(1));
+    movdqa(vectorWrite(ACCM), xmm(2));
+    movdqa(vectorWrite(ACCH), xmm(0));
+    pxor(xmm(4), xmm(4));
+    movdqa(vectorWrite(ACCL), xmm(4));
+    movdqa(xmm(3), xmm(2));
+    punpcklwd(xmm(3), xmm(0));
+    punpckhwd(xmm(2), xmm(0));
+    packssdw(xmm(3), xmm(2));
+    movdqa(vectorWrite(VD), xmm(3));
+    return 1;
+  }
+
+  //VMACF Vd,Vs,Vt(e)
+  case 0x08: {
+    operands();
+    movdqa(xmm(2), xmm(0));
+    pmullw(xmm(2), xmm(1));      //lo
+    pmulhw(xmm(0), xmm(1));      //hi
+    movdqa(xmm(3), xmm(0));
+    psllw(xmm(3), 1);            //md
+    movdqa(xmm(4), xmm(2));
+    psrlw(xmm(4), 15);           //carry
+    psraw(xmm(0), 15);
+    por(xmm(3), xmm(4));
+    psllw(xmm(2), 1);
+    movdqa(xmm(4), vector(ACCL));
+    movdqa(xmm(5), xmm(4));
+    paddusw(xmm(5), xmm(2));     //omask
+    paddw(xmm(4), xmm(2));
+    movdqa(vectorWrite(ACCL), xmm(4));
+    pcmpeqw(xmm(5), xmm(4));
+    pxor(xmm(1), xmm(1));        //zero
+    pcmpeqw(xmm(5), xmm(1));
+    psubw(xmm(3), xmm(5));
+    movdqa(xmm(2), xmm(3));
+    pcmpeqw(xmm(2), xmm(1));
+    pand(xmm(2), xmm(5));        //carry
+    psubw(xmm(0), xmm(2));
+    movdqa(xmm(4), vector(ACCM));
+    movdqa(xmm(5), xmm(4));
+    paddusw(xmm(5), xmm(3));     //omask
+    paddw(xmm(4), xmm(3));
+    pcmpeqw(xmm(5), xmm(4));
+    pcmpeqw(xmm(5), xmm(1));
+    movdqa(vectorWrite(ACCM), xmm(4));
+    movdqa(xmm(2), vector(ACCH));
+    paddw(xmm(2), xmm(0));
+    psubw(xmm(2), xmm(5));
+    movdqa(vectorWrite(ACCH), xmm(2));
+    movdqa(xmm(3), xmm(4));
+    punpcklwd(xmm(3), xmm(2));
+    punpckhwd(xmm(4), xmm(2));
+    packssdw(xmm(3), xmm(4));
+    movdqa(vectorWrite(VD), xmm(3));
+    return 1;
+  }
+
+  //VMADH Vd,Vs,Vt(e)
+  case 0x0f: {
+    operands();
+    movdqa(xmm(2), xmm(0));
+    pmullw(xmm(2), xmm(1));      //lo
+    pmulhw(xmm(0), xmm(1));      //hi
+    movdqa(xmm(3), vector(ACCM));
+    movdqa(xmm(4), xmm(3));
+    paddusw(xmm(4), xmm(2));     //omask
+    paddw(xmm(3), xmm(2));
+    pcmpeqw(xmm(4), xmm(3));
+    pxor(xmm(5), xmm(5));
+    pcmpeqw(xmm(4), xmm(5));
+    psubw(xmm(0), xmm(4));
+    movdqa(xmm(1), vector(ACCH));
+    paddw(xmm(1), xmm(0));
+    movdqa(vectorWrite(ACCM), xmm(3));
+    movdqa(vectorWrite(ACCH), xmm(1));
+    movdqa(xmm(2), xmm(3));
+    punpcklwd(xmm(2), xmm(1));
+    punpckhwd(xmm(3), xmm(1));
+    packssdw(xmm(2), xmm(3));
+    movdqa(vectorWrite(VD), xmm(2));
+    return 1;
+  }
+
+  //VADD Vd,Vs,Vt(e)
+  case 0x10: {
+    operands();
+    movdqa(xmm(2), vector(VCOL));
+    movdqa(xmm(3), xmm(0));
+    paddw(xmm(3), xmm(1));
+    psubw(xmm(3), xmm(2));
+    movdqa(vectorWrite(ACCL), xmm(3));
+    movdqa(xmm(4), xmm(0));
+    pminsw(xmm(4), xmm(1));
+    pmaxsw(xmm(0), xmm(1));
+    psubsw(xmm(4), xmm(2));
+    paddsw(xmm(4), xmm(0));
+    movdqa(vectorWrite(VD), xmm(4));
+    pxor(xmm(5), xmm(5));
+    movdqa(vectorWrite(VCOL), xmm(5));
+    movdqa(vectorWrite(VCOH), xmm(5));
+    return 1;
+  }
+
+  //VSUB Vd,Vs,Vt(e)
+  case 0x11: {
+    operands();
+    movdqa(xmm(2), vector(VCOL));
+    movdqa(xmm(3), xmm(1));
+    psubw(xmm(3), xmm(2));       //udiff
+    movdqa(xmm(4), xmm(1));
+    psubsw(xmm(4), xmm(2));      //sdiff
+    movdqa(xmm(5), xmm(0));
+    psubw(xmm(5), xmm(3));
+    movdqa(vectorWrite(ACCL), xmm(5));
+    movdqa(xmm(2), xmm(4));
+    pcmpgtw(xmm(2), xmm(3));     //overflow
+    psubsw(xmm(0), xmm(4));
+    paddsw(xmm(0), xmm(2));
+    movdqa(vectorWrite(VD), xmm(0));
+    pxor(xmm(5), xmm(5));
+    movdqa(vectorWrite(VCOL), xmm(5));
+    movdqa(vectorWrite(VCOH), xmm(5));
+    return 1;
+  }
+
+  //VAND Vd,Vs,Vt(e)
+  case 0x28: {
+    operands();
+    pand(xmm(0), xmm(1));
+    movdqa(vectorWrite(ACCL), xmm(0));
+    movdqa(vectorWrite(VD), xmm(0));
+    return 1;
+  }
+
+  //VNAND Vd,Vs,Vt(e)
+  case 0x29: {
+    operands();
+    pand(xmm(0), xmm(1));
+    invert(xmm(0));
+    movdqa(vectorWrite(ACCL), xmm(0));
+    movdqa(vectorWrite(VD), xmm(0));
+    return 1;
+  }
+
+  //VOR Vd,Vs,Vt(e)
+  case 0x2a: {
+    operands();
+    por(xmm(0), xmm(1));
+    movdqa(vectorWrite(ACCL), xmm(0));
+    movdqa(vectorWrite(VD), xmm(0));
+    return 1;
+  }
+
+  //VNOR Vd,Vs,Vt(e)
+  case 0x2b: {
+    operands();
+    por(xmm(0), xmm(1));
+    invert(xmm(0));
+    movdqa(vectorWrite(ACCL), xmm(0));
+    movdqa(vectorWrite(VD), xmm(0));
+    return 1;
+  }
+
+  //VXOR Vd,Vs,Vt(e)
+  case 0x2c: {
+    operands();
+    pxor(xmm(0), xmm(1));
+    movdqa(vectorWrite(ACCL), xmm(0));
+    movdqa(vectorWrite(VD), xmm(0));
+    return 1;
+  }
+
+  //VNXOR Vd,Vs,Vt(e)
+  case 0x2d: {
+    operands();
+    pxor(xmm(0), xmm(1));
+    invert(xmm(0));
+    movdqa(vectorWrite(ACCL), xmm(0));
+    movdqa(vectorWrite(VD), xmm(0));
+    return 1;
+  }
+
+  }
+  #undef E
+  #undef ACCH
+  #undef ACCM
+  #undef ACCL
+  #undef VCOH
+  #undef VCOL
+  #undef VD
+  #undef VS
+  #undef VT
+  }
+#endif
+  return 0;
+}
+
 auto RSP::Recompiler::emitLWC2(u32 instruction) -> bool {
+  if(emitLoadSIMD(instruction)) return 0;
+
   #define E  (instruction >> 7 & 15)
   #define i7 (s8(instruction << 1) >> 1)
   switch(instruction >> 11 & 0x1f) {
@@ -1259,6 +1729,8 @@ auto RSP::Recompiler::emitLWC2(u32 instruction) -> bool {
 }
 
 auto RSP::Recompiler::emitSWC2(u32 instruction) -> bool {
+  if(emitStoreSIMD(instruction)) return 0;
+
   #define E  (instruction >> 7 & 15)
   #define i7 (s8(instruction << 1) >> 1)
   switch(instruction >> 11 & 0x1f) {
@@ -1457,4 +1929,5 @@ auto RSP::Recompiler::isTerminal(u32 instruction) -> bool {
 #undef i16
 #undef n16
 #undef n26
+#undef Field
 #undef callvu
@@ -370,8 +370,43 @@ struct RSP : Thread, Memory::RCP<RSP> {
     auto emitREGIMM(u32 instruction) -> bool;
     auto emitSCC(u32 instruction) -> bool;
     auto emitVU(u32 instruction) -> bool;
+    auto emitVUSIMD(u32 instruction) -> bool;
     auto emitLWC2(u32 instruction) -> bool;
     auto emitSWC2(u32 instruction) -> bool;
+    auto emitLoadSIMD(u32 instruction) -> bool;
+    auto emitStoreSIMD(u32 instruction) -> bool;
+    auto emitAddressSIMD(u32 instruction, u32 size) -> sljit_jump*;
+    auto emitEpilogue() -> void;
+
+    //VU registers are kept in host vector registers while recompiled code runs inline,
+    //and are written back before any call into the emulator and before the block returns.
+    struct Vectors {
+      static constexpr u32 Slots = 10;  //xmm6-xmm15; xmm0-xmm5 are scratch registers
+
+      u32 offset[Slots];  //offset of the VU member held by each slot, or ~0 when unused
+      bool dirty[Slots];
+      u32 used[Slots];
+      u32 counter;
+    } vectors;
+
+    auto vectorReset() -> void;
+    auto vectorSlot(u32 offset, bool load) -> u32;
+    auto vectorSave() -> void;
+    auto vectorRestore() -> void;
+    auto vectorRelease() -> void;
+  #if defined(ARCHITECTURE_AMD64)
+    auto vector(u32 offset) -> xmm;
+    auto vectorWrite(u32 offset) -> xmm;
+  #endif
+
+    template<typename... P>
+    auto call(P&&... p) -> void {
+      vectorRelease();
+      called = true;
+      generic::call(std::forward<P>(p)...);
+    }
+
+    bool called = false;  //whether the current instruction calls into the emulator
 
     auto isTerminal(u32 instruction) -> bool;
 
@@ -22,7 +22,7 @@ auto option(string name, string value) -> bool {
   return true;
 }
 
-Scheduler scheduler;
+instance_local Scheduler scheduler;
 System system;
 #include "serialization.cpp"
 
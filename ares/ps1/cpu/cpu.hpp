@@ -468,7 +468,8 @@ struct CPU : Thread {
   auto MFC2(u32& rt, u8 rd) -> void;
   auto MTC2(cu32& rt, u8 rd) -> void;
   auto MVMVA(bool lm, u8 tv, u8 mv, u8 mm, u8 sf) -> void;
-  auto MVMVA_(bool lm, u8 MmMvTv, u8 sf) -> void;
+  template<u32 MmMvTv> auto MVMVA(bool lm, u8 sf) -> void;
+  static const array<void (CPU::*[64])(bool, u8)> MVMVAs;
   template<u32> auto NC(const GTE::v16&) -> void;
   auto NCCS(bool lm, u8 sf) -> void;
   auto NCCT(bool lm, u8 sf) -> void;
@@ -535,6 +536,9 @@ struct CPU : Thread {
     auto emitREGIMM(u32 instruction) -> bool;
     auto emitSCC(u32 instruction) -> bool;
     auto emitGTE(u32 instruction) -> bool;
+    auto emitAddress(u32 instruction) -> array<sljit_jump*[3]>;
+    template<u32 Size, bool Signed> auto emitLoad(u32 instruction) -> sljit_jump*;
+    template<u32 Size> auto emitStore(u32 instruction) -> sljit_jump*;
 
     bump_allocator allocator;
     Pool* pools[1 << 21];  //2_MiB * sizeof(void*) = 16_MiB
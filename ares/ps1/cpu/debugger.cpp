@@ -33,6 +33,11 @@ auto CPU::Debugger::instruction() -> void {
   u32 address = cpu.pipeline.address;
   u32 instruction = cpu.pipeline.instruction;
   if(tracer.instruction->address(address)) {
+    if(tracer.instruction->binary()) {
+      tracer.instruction->record(instruction);
+      for(u32 index : range(32)) tracer.instruction->record(index, cpu.ipu.r[index]);
+      return;
+    }
     cpu.disassembler.showColors = 0;
     tracer.instruction->notify(cpu.disassembler.disassemble(address, instruction), {});
     cpu.disassembler.showColors = 1;
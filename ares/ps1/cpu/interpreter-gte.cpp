@@ -295,6 +295,18 @@ auto CPU::GTE::setOtz(s64 value) -> void {
 //
 
 auto CPU::GTE::matrixMultiply(const m16& matrix, const v16& vector, const v32& translation) -> v64 {
+  //each product is at most 2^30 in magnitude, so the MAC registers can only overflow when the
+  //translation is close to its limits: otherwise skip checking and clipping every partial sum.
+  static constexpr s32 limit = 0x7ff0'0000;
+  if(likely(translation.x >= -limit && translation.x <= limit
+         && translation.y >= -limit && translation.y <= limit
+         && translation.z >= -limit && translation.z <= limit)) {
+    s64 x = (s64(translation.x) << 12) + matrix.a.x * vector.x + matrix.a.y * vector.y + matrix.a.z * vector.z;
+    s64 y = (s64(translation.y) << 12) + matrix.b.x * vector.x + matrix.b.y * vector.y + matrix.b.z * vector.z;
+    s64 z = (s64(translation.z) << 12) + matrix.c.x * vector.x + matrix.c.y * vector.y + matrix.c.z * vector.z;
+    return {x, y, z};
+  }
+
   s64 x = extend<1>(extend<1>(extend<1>((s64(translation.x) << 12) + matrix.a.x * vector.x) + matrix.a.y * vector.y) + matrix.a.z * vector.z);
   s64 y = extend<2>(extend<2>(extend<2>((s64(translation.y) << 12) + matrix.b.x * vector.x) + matrix.b.y * vector.y) + matrix.b.z * vector.z);
   s64 z = extend<3>(extend<3>(extend<3>((s64(translation.z) << 12) + matrix.c.x * vector.x) + matrix.c.y * vector.y) + matrix.c.z * vector.z);
@@ -569,36 +581,40 @@ auto CPU::MTC2(cu32& rt, u8 rd) -> void {
 }
 
 auto CPU::MVMVA(bool lm, u8 tv, u8 mv, u8 mm, u8 sf) -> void {
+  (this->*MVMVAs[mm << 4 | mv << 2 | tv])(lm, sf);
+}
+
+//the matrix, vector and translation selectors are resolved at compile-time
+template<u32 MmMvTv>
+auto CPU::MVMVA(bool lm, u8 sf) -> void {
+  static constexpr u32 tv = MmMvTv >> 0 & 3;
+  static constexpr u32 mv = MmMvTv >> 2 & 3;
+  static constexpr u32 mm = MmMvTv >> 4 & 3;
+
   prologue(lm, sf);
   v32 tr;
-  switch(tv) {
-  case 0: tr = translation; break;
-  case 1: tr = backgroundColor; break;
-  case 2: tr = farColor; break;
-  case 3: tr = {0, 0, 0}; break;
-  }
+  if constexpr(tv == 0) tr = translation;
+  if constexpr(tv == 1) tr = backgroundColor;
+  if constexpr(tv == 2) tr = farColor;
+  if constexpr(tv == 3) tr = {0, 0, 0};
 
   v16 vector;
-  switch(mv) {
-  case 0: vector = v.a; break;
-  case 1: vector = v.b; break;
-  case 2: vector = v.c; break;
-  case 3: vector = ir; break;
-  }
+  if constexpr(mv == 0) vector = v.a;
+  if constexpr(mv == 1) vector = v.b;
+  if constexpr(mv == 2) vector = v.c;
+  if constexpr(mv == 3) vector = ir;
 
   m16 matrix;
-  switch(mm) {
-  case 0: matrix = rotation; break;
-  case 1: matrix = light; break;
-  case 2: matrix = color; break;
-  case 3:  //reserved
+  if constexpr(mm == 0) matrix = rotation;
+  if constexpr(mm == 1) matrix = light;
+  if constexpr(mm == 2) matrix = color;
+  if constexpr(mm == 3) {  //reserved
     matrix.a.x = -(rgbc.r << 4); matrix.a.y = +(rgbc.r << 4); matrix.a.z = ir.t;
     matrix.b.x = rotation.a.z; matrix.b.y = rotation.a.z; matrix.b.z = rotation.a.z;
     matrix.c.x = rotation.b.y; matrix.c.y = rotation.b.y; matrix.c.z = rotation.b.y;
-    break;
   }
 
-  if(tv != 2) {
+  if constexpr(tv != 2) {
     setMacAndIr(matrixMultiply(matrix, vector, tr));
   } else {
     setIr<1>(extend<1>((s64(tr.x) << 12) + matrix.a.x * vector.x) >> sf);
@@ -614,13 +630,13 @@ auto CPU::MVMVA(bool lm, u8 tv, u8 mv, u8 mm, u8 sf) -> void {
   epilogue();
 }
 
-auto CPU::MVMVA_(bool lm, u8 MmMvTv, u8 sf) -> void {
-  u8 tv = MmMvTv >> 0 & 3;
-  u8 mv = MmMvTv >> 2 & 3;
-  u8 mm = MmMvTv >> 4 & 3;
-  MVMVA(lm, tv, mv, mm, sf);
+template<u32... MmMvTv>
+static auto MVMVATable(std::integer_sequence<u32, MmMvTv...>) -> array<void (CPU::*[64])(bool, u8)> {
+  return {&CPU::MVMVA<MmMvTv>...};
 }
 
+const array<void (CPU::*[64])(bool, u8)> CPU::MVMVAs = MVMVATable(std::make_integer_sequence<u32, 64>{});
+
 //meta-instruction
 template<u32 m>
 auto CPU::NC(const v16& vector) -> void {
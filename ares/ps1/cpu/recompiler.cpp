@@ -61,6 +61,88 @@ auto CPU::Recompiler::emit(u32 address) -> Block* {
 #define n16 u16(instruction)
 #define n26 u32(instruction & 0x03ff'ffff)
 
+#define Field(f) mem(sreg(0), (u8*)&self.f - (u8*)&self)
+
+//main RAM is accessed directly by recompiled code: the effective address is tested inline,
+//and everything other than RAM through KUSEG, KSEG0 or KSEG1 falls back to the interpreter.
+//the effective address is left in reg(1); the returned jumps must be bound to the slow path.
+auto CPU::Recompiler::emitAddress(u32 instruction) -> array<sljit_jump*[3]> {
+  array<sljit_jump*[3]> slow;
+  mov32(reg(1), mem(Rs));
+  add32(reg(1), reg(1), imm(i16));
+  //rejects $40000000-$7fffffff, KSEG2, and physical addresses beyond the RAM mirrors
+  test32(reg(1), imm(0x5f80'0000), set_z);
+  slow[0] = jump(flag_nz);
+  //rejects $20000000-$207fffff (KSEG0 and KSEG1 addresses are negative)
+  slow[1] = cmp32_jump(reg(1), imm(0x0080'0000), flag_sge);
+  //cache isolation redirects KUSEG and KSEG0 accesses away from RAM
+  static_assert(sizeof(self.scc.status.cache.isolate) == 1);
+  mov32_u8(reg(0), Field(scc.status.cache.isolate));
+  slow[2] = cmp32_jump(reg(0), imm(0), flag_ne);
+  return slow;
+}
+
+//inlines CPU::read<Size>() and CPU::load() for RAM addresses
+template<u32 Size, bool Signed>
+auto CPU::Recompiler::emitLoad(u32 instruction) -> sljit_jump* {
+  auto slow = emitAddress(instruction);
+  if constexpr(Size == Byte) and32(reg(1), reg(1), Field(ram.maskByte));
+  if constexpr(Size == Half) and32(reg(1), reg(1), Field(ram.maskHalf));
+  if constexpr(Size == Word) and32(reg(1), reg(1), Field(ram.maskWord));
+  mov64_u32(reg(1), reg(1));
+  mov64(reg(0), Field(ram.data));
+  add64(reg(0), reg(0), reg(1));
+  if constexpr(Size == Byte &&  Signed) mov32_s8 (reg(1), mem(reg(0), 0));
+  if constexpr(Size == Byte && !Signed) mov32_u8 (reg(1), mem(reg(0), 0));
+  if constexpr(Size == Half &&  Signed) mov32_s16(reg(1), mem(reg(0), 0));
+  if constexpr(Size == Half && !Signed) mov32_u16(reg(1), mem(reg(0), 0));
+  if constexpr(Size == Word) mov32(reg(1), mem(reg(0), 0));
+  add64(Field(Thread::clock), Field(Thread::clock), imm(4));
+
+  lea(reg(2), Rt);
+  auto pending = cmp64_jump(Field(delay.load[0].target), reg(2), flag_ne);
+  mov64(Field(delay.load[0].target), imm(0));
+  setLabel(pending);
+  mov64(Field(delay.load[1].target), reg(2));
+  mov32(Field(delay.load[1].source), reg(1));
+
+  auto fast = jump();
+  for(auto branch : slow) setLabel(branch);
+  return fast;
+}
+
+//inlines CPU::write<Size>() and invalidate() for RAM addresses
+template<u32 Size>
+auto CPU::Recompiler::emitStore(u32 instruction) -> sljit_jump* {
+  auto slow = emitAddress(instruction);
+  add64(Field(Thread::clock), Field(Thread::clock), imm(4));
+
+  static_assert(sizeof(Pool*) == 8);
+  lshr32(reg(0), reg(1), imm(8));
+  and32(reg(0), reg(0), imm(0x1fffff));
+  mov64_u32(reg(0), reg(0));
+  shl64(reg(0), reg(0), imm(3));
+  add64(reg(0), reg(0), sreg(0));
+  mov64(mem(reg(0), (u8*)pools - (u8*)&self), imm(0));
+
+  if constexpr(Size == Byte) and32(reg(1), reg(1), Field(ram.maskByte));
+  if constexpr(Size == Half) and32(reg(1), reg(1), Field(ram.maskHalf));
+  if constexpr(Size == Word) and32(reg(1), reg(1), Field(ram.maskWord));
+  mov64_u32(reg(1), reg(1));
+  mov64(reg(0), Field(ram.data));
+  add64(reg(0), reg(0), reg(1));
+  mov32(reg(1), mem(Rt));
+  if constexpr(Size == Byte) mov32_u8 (mem(reg(0), 0), reg(1));
+  if constexpr(Size == Half) mov32_u16(mem(reg(0), 0), reg(1));
+  if constexpr(Size == Word) mov32    (mem(reg(0), 0), reg(1));
+
+  auto fast = jump();
+  for(auto branch : slow) setLabel(branch);
+  return fast;
+}
+
+#undef Field
+
 auto CPU::Recompiler::emitEXECUTE(u32 instruction) -> bool {
   switch(instruction >> 26) {
 
@@ -223,19 +305,23 @@ auto CPU::Recompiler::emitEXECUTE(u32 instruction) -> bool {
 
   //LB Rt,Rs,i16
   case 0x20: {
+    auto fast = emitLoad<Byte, 1>(instruction);
     lea(reg(1), Rt);
     lea(reg(2), Rs);
     mov32(reg(3), imm(i16));
     call(&CPU::LB);
+    setLabel(fast);
     return 0;
   }
 
   //LH Rt,Rs,i16
   case 0x21: {
+    auto fast = emitLoad<Half, 1>(instruction);
     lea(reg(1), Rt);
     lea(reg(2), Rs);
     mov32(reg(3), imm(i16));
     call(&CPU::LH);
+    setLabel(fast);
     return 0;
   }
 
@@ -250,28 +336,34 @@ auto CPU::Recompiler::emitEXECUTE(u32 instruction) -> bool {
 
   //LW Rt,Rs,i16
   case 0x23: {
+    auto fast = emitLoad<Word, 1>(instruction);
     lea(reg(1), Rt);
     lea(reg(2), Rs);
     mov32(reg(3), imm(i16));
     call(&CPU::LW);
+    setLabel(fast);
     return 0;
   }
 
   //LBU Rt,Rs,i16
   case 0x24: {
+    auto fast = emitLoad<Byte, 0>(instruction);
     lea(reg(1), Rt);
     lea(reg(2), Rs);
     mov32(reg(3), imm(i16));
     call(&CPU::LBU);
+    setLabel(fast);
     return 0;
   }
 
   //LHU Rt,Rs,i16
   case 0x25: {
+    auto fast = emitLoad<Half, 0>(instruction);
     lea(reg(1), Rt);
     lea(reg(2), Rs);
     mov32(reg(3), imm(i16));
     call(&CPU::LHU);
+    setLabel(fast);
     return 0;
   }
 
@@ -292,19 +384,23 @@ auto CPU::Recompiler::emitEXECUTE(u32 instruction) -> bool {
 
   //SB Rt,Rs,i16
   case 0x28: {
+    auto fast = emitStore<Byte>(instruction);
     lea(reg(1), Rt);
     lea(reg(2), Rs);
     mov32(reg(3), imm(i16));
     call(&CPU::SB);
+    setLabel(fast);
     return 0;
   }
 
   //SH Rt,Rs,i16
   case 0x29: {
+    auto fast = emitStore<Half>(instruction);
     lea(reg(1), Rt);
     lea(reg(2), Rs);
     mov32(reg(3), imm(i16));
     call(&CPU::SH);
+    setLabel(fast);
     return 0;
   }
 
@@ -319,10 +415,12 @@ auto CPU::Recompiler::emitEXECUTE(u32 instruction) -> bool {
 
   //SW Rt,Rs,i16
   case 0x2b: {
+    auto fast = emitStore<Word>(instruction);
     lea(reg(1), Rt);
     lea(reg(2), Rs);
     mov32(reg(3), imm(i16));
     call(&CPU::SW);
+    setLabel(fast);
     return 0;
   }
 
@@ -930,9 +1028,8 @@ auto CPU::Recompiler::emitGTE(u32 instruction) -> bool {
   //MVMVA Lm,Tv,Mv,Mm,Sf
   case 0x12: {
     mov32(reg(1), imm(Lm));
-    mov32(reg(2), imm(MmMvTv));
-    mov32(reg(3), imm(Sf));
-    call(&CPU::MVMVA_);
+    mov32(reg(2), imm(Sf));
+    call(MVMVAs[MmMvTv]);
     return 0;
   }
 
@@ -1,5 +1,6 @@
 auto GPU::Blitter::queue() -> void {
   self.refreshed = true;
+  self.renderer.synchronize();
 
   //if the display is disabled, output a black screen image
   if(blank = self.io.displayDisable) {
@@ -74,6 +75,7 @@ auto GPU::Blitter::queue() -> void {
 auto GPU::Blitter::refresh() -> void {
   if(blank) return;
 
+  self.renderer.lock();
   self.vram.mutex.lock();
   auto output = self.screen->pixels(1).data();
 
@@ -106,6 +108,7 @@ auto GPU::Blitter::refresh() -> void {
   }
 
   self.vram.mutex.unlock();
+  self.renderer.unlock();
 }
 
 auto GPU::Blitter::power() -> void {
@@ -388,6 +388,7 @@ auto GPU::writeGP0(u32 value, bool isThread) -> void {
     u16 targetY = queue.data[2].bit(16,31);
     u16 width   = queue.data[3].bit( 0,15);
     u16 height  = queue.data[3].bit(16,31);
+    renderer.synchronize();
     for(u32 y : range(height)) {
       for(u32 x : range(width)) {
         u16 pixel = vram2D[n9(y + sourceY) & 511][n10(x + sourceX) & 1023];
@@ -409,6 +410,7 @@ auto GPU::writeGP0(u32 value, bool isThread) -> void {
     io.copy.px     = 0;
     io.copy.py     = 0;
     io.mode        = Mode::CopyToVRAM;
+    renderer.synchronize();
     return queue.reset();
   }
 
@@ -422,6 +424,7 @@ auto GPU::writeGP0(u32 value, bool isThread) -> void {
     io.copy.px     = 0;
     io.copy.py     = 0;
     io.mode        = Mode::CopyFromVRAM;
+    renderer.synchronize();
     return queue.reset();
   }
 
@@ -315,6 +315,7 @@ struct GPU : Thread, Memory::Interface {
     template<u32 Flags> auto rectangle() -> void;
     template<u32 Flags> auto fill() -> void;
     template<u32 Flags> auto cost(u32 pixels) const -> u32;
+    auto owns(s32 y) const -> bool;
     auto execute() -> void;
 
     u32  command;
@@ -344,6 +345,10 @@ struct GPU : Thread, Memory::Interface {
     Vertex v2;
     Vertex v3;
     Size size;
+
+    //threaded rendering: only rows within VRAM bands owned by this worker are drawn
+    u32  band  = 0;
+    u32  bands = 1;
   };
 
 //unserialized:
@@ -352,13 +357,41 @@ struct GPU : Thread, Memory::Interface {
     GPU& self;
     Renderer(GPU& self) : self(self) {}
 
+    //VRAM is tracked in 16x16 tiles of 64x32 pixels; row n is a mask of the tiles in that row
+    struct Tiles {
+      auto intersects(const Tiles& source) const -> bool;
+      auto operator|=(const Tiles& source) -> Tiles&;
+
+      u16 row[16] = {};
+    };
+
+    auto region(s32 x, s32 y, s32 width, s32 height) const -> Tiles;
+    auto targets(const Render& render) const -> Tiles;
+    auto sources(const Render& render) const -> Tiles;
+    auto execute(Render& render) -> void;
     auto queue(Render& render) -> void;
+    auto synchronize() -> void;
+    auto lock() -> void;
+    auto unlock() -> void;
     auto main(uintptr_t) -> void;
     auto kill() -> void;
     auto power() -> void;
 
-    nall::thread handle;
-    queue_spsc<Render[65536]> fifo;
+    //VRAM is split into 32 bands of 16 rows; band n is owned by worker n % workers
+    static constexpr u32 Workers = 4;
+
+    struct Worker {
+      nall::thread handle;
+      queue_spsc<Render[16384]> fifo;
+      std::mutex mutex;
+      u32 submitted = 0;
+      std::atomic<u32> completed = 0;
+    } worker[Workers];
+    u32 workers = 1;
+
+    //tiles written to and sampled from by primitives still in flight
+    Tiles written;
+    Tiles sampled;
   } renderer{*this};
 
   //blitter.cpp
@@ -167,7 +167,8 @@ auto GPU::Render::line() -> void {
   s32 steps = abs(d.x) > abs(d.y) ? abs(d.x) : abs(d.y);
   if(steps == 0) {
     if(v0.x == v1.x && v0.y == v1.y) {
-      return pixel<Flags>(v0, v0);
+      if(owns(v0.y)) pixel<Flags>(v0, v0);
+      return;
     } else {
       debug(unimplemented, "GPU::renderLine(steps=0)");
       return;
@@ -179,7 +180,7 @@ auto GPU::Render::line() -> void {
 
   u32 pixels = 0;
   for(u16 step : range(steps)) {
-    pixel<Flags | Dither>({p.x >> 16, p.y >> 16}, v0);
+    if(owns(p.y >> 16)) pixel<Flags | Dither>({p.x >> 16, p.y >> 16}, v0);
     p.x += s.x, p.y += s.y;
     pixels++;
   }
@@ -222,9 +223,9 @@ auto GPU::Render::triangle() -> void {
   Point d2{v0.y - v1.y, v1.x - v0.x};
 
   s32 bias[3];  //avoid drawing overlapping top-left edges of triangles
-  bias[0] = -(d0.x < 0 || d0.x == 0 && d0.y < 0);
-  bias[1] = -(d1.x < 0 || d1.x == 0 && d1.y < 0);
-  bias[2] = -(d2.x < 0 || d2.x == 0 && d2.y < 0);
+  bias[0] = -(d0.x < 0 || (d0.x == 0 && d0.y < 0));
+  bias[1] = -(d1.x < 0 || (d1.x == 0 && d1.y < 0));
+  bias[2] = -(d2.x < 0 || (d2.x == 0 && d2.y < 0));
 
   Point p0, p1, p2;
   Delta dr, dg, db, du, dv;
@@ -269,6 +270,7 @@ auto GPU::Render::triangle() -> void {
     if constexpr(Flags & Shade) pr.x = pr.y, pg.x = pg.y, pb.x = pb.y;
     if constexpr(Flags & Texture) pu.x = pu.y, pv.x = pv.y;
 
+    if(owns(vp.y))
     for(vp.x = vmin.x; vp.x <= vmax.x; vp.x++) {
       if((p0.x + bias[0] | p1.x + bias[1] | p2.x + bias[2]) >= 0) {
         pixel<Flags | Dithering>(vp, Color::fromRGB(pr.x, pg.x, pb.x), {s32(pu.x), s32(pv.x)});
@@ -308,6 +310,7 @@ template<u32 Flags>
 auto GPU::Render::fill() -> void {
   auto color = v0.to16();
   for(u32 y : range(size.h)) {
+    if(!owns(y + v0.y)) continue;
     for(u32 x : range(size.w)) {
       gpu.vram2D[y + v0.y & 511][x + v0.x & 1023] = color;
     }
@@ -358,6 +361,11 @@ auto GPU::Render::cost(u32 pixels) const -> u32 {
   }
 }
 
+auto GPU::Render::owns(s32 y) const -> bool {
+  if(bands == 1) return true;
+  return ((y & 511) >> 4) % bands == band;
+}
+
 auto GPU::Render::execute() -> void {
   switch(command) {
   case 0x02: return fill<Fill>();
@@ -412,21 +420,151 @@ auto GPU::Render::execute() -> void {
   }
 }
 
+auto GPU::Renderer::Tiles::intersects(const Tiles& source) const -> bool {
+  u16 overlap = 0;
+  for(u32 n : range(16)) overlap |= row[n] & source.row[n];
+  return overlap;
+}
+
+auto GPU::Renderer::Tiles::operator|=(const Tiles& source) -> Tiles& {
+  for(u32 n : range(16)) row[n] |= source.row[n];
+  return *this;
+}
+
+//returns the tiles covered by a region of VRAM, which wraps around at its edges
+auto GPU::Renderer::region(s32 x, s32 y, s32 width, s32 height) const -> Tiles {
+  Tiles tiles;
+  if(width <= 0 || height <= 0) return tiles;
+
+  u16 columns = 0;
+  if(width > 1024 - 64) {
+    columns = 0xffff;
+  } else {
+    u32 first = (x & 1023) >> 6;
+    u32 last  = ((x + width - 1) & 1023) >> 6;
+    for(u32 column = first; ; column = (column + 1) & 15) {
+      columns |= 1 << column;
+      if(column == last) break;
+    }
+  }
+
+  u32 first = (y & 511) >> 5;
+  u32 last  = height > 512 - 32 ? (first + 15) & 15 : ((y + height - 1) & 511) >> 5;
+  for(u32 row = first; ; row = (row + 1) & 15) {
+    tiles.row[row] = columns;
+    if(row == last) break;
+  }
+  return tiles;
+}
+
+auto GPU::Renderer::targets(const Render& render) const -> Tiles {
+  if(render.command == 0x02) return region(render.v0.x, render.v0.y, render.size.w, render.size.h);
+
+  //all other primitives are drawn within their bounding box, offset and then clipped to the drawing area
+  s32 x1 = render.drawingAreaOriginX1, x2 = render.drawingAreaOriginX2;
+  s32 y1 = render.drawingAreaOriginY1, y2 = render.drawingAreaOriginY2;
+  if(x2 < x1 || y2 < y1) return region(0, 0, 1024, 512);
+
+  Point vmin{render.v0.x, render.v0.y};
+  Point vmax{render.v0.x, render.v0.y};
+  auto include = [&](s32 x, s32 y) {
+    vmin.x = min(vmin.x, x), vmin.y = min(vmin.y, y);
+    vmax.x = max(vmax.x, x), vmax.y = max(vmax.y, y);
+  };
+  if(render.command < 0x40) {  //polygons
+    include(render.v1.x, render.v1.y);
+    include(render.v2.x, render.v2.y);
+    if(render.command & 0x08) include(render.v3.x, render.v3.y);
+  } else if(render.command < 0x60) {  //lines
+    include(render.v1.x, render.v1.y);
+  } else {  //rectangles
+    include(render.v0.x + render.size.w, render.v0.y + render.size.h);
+  }
+
+  s32 ox = render.drawingAreaOffsetX, oy = render.drawingAreaOffsetY;
+  vmin.x = std::clamp(vmin.x + ox, x1, x2), vmin.y = std::clamp(vmin.y + oy, y1, y2);
+  vmax.x = std::clamp(vmax.x + ox, x1, x2), vmax.y = std::clamp(vmax.y + oy, y1, y2);
+  return region(vmin.x, vmin.y, vmax.x - vmin.x + 1, vmax.y - vmin.y + 1);
+}
+
+auto GPU::Renderer::sources(const Render& render) const -> Tiles {
+  u32 command = render.command;
+  if(command < 0x20 || command >= 0x80 || (command & 0x60) == 0x40) return {};
+  if(!(command & 0x04) || render.textureDepth > 2) return {};
+  //texture pages are 256 texels square; 4bpp and 8bpp texels are packed into 16-bit VRAM words
+  Tiles tiles = region(render.texturePageBaseX, render.texturePageBaseY, 64 << render.textureDepth, 256);
+  if(render.textureDepth < 2) tiles |= region(render.texturePaletteX, render.texturePaletteY, render.textureDepth ? 256 : 16, 1);
+  return tiles;
+}
+
+//draws a primitive on the calling thread, excluding the workers and the blitter
+auto GPU::Renderer::execute(Render& render) -> void {
+  lock();
+  self.vram.mutex.lock();
+  render.execute();
+  self.vram.mutex.unlock();
+  unlock();
+}
+
 auto GPU::Renderer::queue(Render& render) -> void {
   if constexpr(Accuracy::GPU::Threaded) {
-    fifo.await_write(render);
+    //every worker receives every primitive, and draws only the rows of the bands it owns.
+    //texels may be sampled from anywhere in VRAM, so wait for the other workers to catch up
+    //before reading tiles they may still be writing, or writing tiles they may still be reading.
+    Tiles target = targets(render);
+    Tiles source = sources(render);
+    if(source.intersects(written) || target.intersects(sampled)) synchronize();
+    if(source.intersects(target)) {
+      //the primitive may sample its own output: it must be drawn in order by a single thread
+      synchronize();
+      return execute(render);
+    }
+    written |= target;
+    sampled |= source;
+    for(u32 n : range(workers)) {
+      worker[n].submitted++;
+      worker[n].fifo.await_write(render);
+    }
   } else if constexpr(true) {
-    render.execute();
+    execute(render);
   }
 }
 
-auto GPU::Renderer::main(uintptr_t) -> void {
+//waits until all queued primitives have been drawn
+auto GPU::Renderer::synchronize() -> void {
+  if constexpr(Accuracy::GPU::Threaded) {
+    for(u32 n : range(workers)) {
+      while(worker[n].completed != worker[n].submitted) spinloop();
+    }
+    written = {};
+    sampled = {};
+  }
+}
+
+//prevents the workers from drawing while VRAM is being read from another thread
+auto GPU::Renderer::lock() -> void {
+  if constexpr(Accuracy::GPU::Threaded) {
+    for(u32 n : range(workers)) worker[n].mutex.lock();
+  }
+}
+
+auto GPU::Renderer::unlock() -> void {
+  if constexpr(Accuracy::GPU::Threaded) {
+    for(u32 n : reverse(range(workers))) worker[n].mutex.unlock();
+  }
+}
+
+auto GPU::Renderer::main(uintptr_t parameter) -> void {
+  auto& worker = this->worker[parameter];
   while(true) {
-    auto render = fifo.await_read();
-    self.vram.mutex.lock();
-    render.execute();
-    self.vram.mutex.unlock();
+    auto render = worker.fifo.await_read();
     if(render.command == 0x100) thread::exit();
+    render.band  = parameter;
+    render.bands = workers;
+    worker.mutex.lock();
+    render.execute();
+    worker.mutex.unlock();
+    worker.completed++;
   }
 }
 
@@ -434,15 +572,25 @@ auto GPU::Renderer::kill() -> void {
   if constexpr(Accuracy::GPU::Threaded) {
     Render kill;
     kill.command = 0x100;
-    queue(kill);
-    handle.join();
+    for(u32 n : range(workers)) {
+      worker[n].fifo.await_write(kill);
+      worker[n].handle.join();
+    }
   }
 }
 
 auto GPU::Renderer::power() -> void {
   if constexpr(Accuracy::GPU::Threaded) {
     kill();
-    fifo.flush();
-    handle = thread::create({&GPU::Renderer::main, &self.renderer});
+    workers = std::clamp<u32>(std::thread::hardware_concurrency() / 2, 1, Workers);
+    written = {};
+    sampled = {};
+    for(u32 n : range(workers)) {
+      worker[n].fifo.flush();
+      worker[n].fifo.setBlocking(true);
+      worker[n].submitted = 0;
+      worker[n].completed = 0;
+      worker[n].handle = thread::create({&GPU::Renderer::main, &self.renderer}, n);
+    }
   }
 }
@@ -1,4 +1,5 @@
 auto GPU::serialize(serializer& s) -> void {
+  renderer.synchronize();
   Thread::serialize(s);
 
   s(vram);
@@ -6,7 +6,8 @@ auto Cartridge::Debugger::load(Node::Object parent) -> void {
       return cartridge.rom.read(address);
     });
     memory.rom->setWrite([&](u32 address, u8 data) -> void {
-      return cartridge.rom.program(address, data);
+      cartridge.rom.program(address, data);
+      cpu.cache.flush();
     });
   }
 
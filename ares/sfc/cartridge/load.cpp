@@ -81,7 +81,7 @@ auto Cartridge::loadMap(Markup::Node map, T& memory) -> n32 {
 }
 
 auto Cartridge::loadMap(
-  Markup::Node map, const function<n8 (n24, n8)>& reader, const function<void (n24, n8)>& writer
+  Markup::Node map, const inline_function<n8 (n24, n8)>& reader, const inline_function<void (n24, n8)>& writer
 ) -> n32 {
   auto address = map["address"].text();
   auto size = map["size"].natural();
@@ -93,7 +93,7 @@ auto Cartridge::loadMap(
 //memory(type=ROM,content=Program)
 auto Cartridge::loadROM(Markup::Node node) -> void {
   loadMemory(rom, node);
-  for(auto leaf : node.find("map")) loadMap(leaf, rom);
+  for(auto leaf : node.find("map")) bus.direct(loadMap(leaf, rom), rom.data());
 }
 
 //memory(type=RAM,content=Save)
@@ -5,7 +5,8 @@ auto SA1::Debugger::load(Node::Object parent) -> void {
     return sa1.rom.read(address);
   });
   memory.rom->setWrite([&](u32 address, u8 data) -> void {
-    return sa1.rom.program(address, data);
+    sa1.rom.program(address, data);
+    sa1.cache.flush();
   });
 
   if(sa1.bwram) {
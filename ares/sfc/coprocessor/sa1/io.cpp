@@ -170,24 +170,28 @@ auto SA1::writeIOCPU(n24 address, n8 data) -> void {
   case 0x2220:
     io.cb     = data.bit(0,2);
     io.cbmode = data.bit(7);
+    cache.flush();
     return;
 
   //(DXB) Super MMC bank D
   case 0x2221:
     io.db     = data.bit(0,2);
     io.dbmode = data.bit(7);
+    cache.flush();
     return;
 
   //(EXB) Super MMC bank E
   case 0x2222:
     io.eb     = data.bit(0,2);
     io.ebmode = data.bit(7);
+    cache.flush();
     return;
 
   //(FXB) Super MMC bank F
   case 0x2223:
     io.fb     = data.bit(0,2);
     io.fbmode = data.bit(7);
+    cache.flush();
     return;
 
   //(BMAPS) S-CPU BW-RAM address mapping
@@ -18,6 +18,25 @@ inline auto SA1::idleBranch() -> void {
   if(r.pc.d & 1) idleJump();
 }
 
+//the instruction cache may read directly from ROM only when every byte is plain ROM, in order.
+auto SA1::fetchable(n24 address) -> const n8* {
+  auto offset = rom.offsetSA1(address);
+  if(!offset) return nullptr;
+  for(u32 n : range(1, InstructionCache::Bytes)) {
+    auto next = rom.offsetSA1(address + n);
+    if(!next || *next != *offset + n) return nullptr;
+  }
+  return rom.data() + *offset;
+}
+
+//read() from ROM, which has already been read from the instruction cache.
+auto SA1::fetched(n24 address, n8 data) -> void {
+  r.mar = address;
+  step();
+  if(rom.conflict()) step();
+  r.mdr = data;
+}
+
 auto SA1::read(n24 address) -> n8 {
   r.mar = address;
   n8 data = r.mdr;
@@ -67,3 +67,22 @@ auto SA1::ROM::readSA1(n24 address, n8 data) -> n8 {
 
 auto SA1::ROM::writeSA1(n24 address, n8 data) -> void {
 }
+
+//returns the ROM offset that readSA1() would read, or nothing if the byte is not plain ROM.
+auto SA1::ROM::offsetSA1(n24 address) const -> maybe<u32> {
+  if((address & 0x408000) != 0x008000 && (address & 0xc00000) != 0xc00000) return nothing;
+  if((address & 0x408000) == 0x008000) {
+    address = (address & 0x800000) >> 2 | (address & 0x3f0000) >> 1 | address & 0x007fff;
+  }
+  if((address & 0xfffff0) == 0x007fe0) return nothing;  //reset vector overrides
+
+  bool lo = address < 0x400000;
+  address &= 0x3fffff;
+  u32  bank[] = {sa1.io.cb,     sa1.io.db,     sa1.io.eb,     sa1.io.fb};
+  bool mode[] = {sa1.io.cbmode, sa1.io.dbmode, sa1.io.ebmode, sa1.io.fbmode};
+  u32 select = address >> 20;
+  if(!lo || mode[select]) address = bank[select] << 20 | address & 0x0fffff;
+
+  if((address & 0x400000) && bsmemory.size()) return nothing;
+  return bus.mirror(address, size());
+}
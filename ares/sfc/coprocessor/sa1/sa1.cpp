@@ -11,11 +11,17 @@ SA1 sa1;
 auto SA1::load(Node::Object parent) -> void {
   node = parent->append<Node::Object>("SA1");
 
+  instructionCache = node->append<Node::Setting::Boolean>("Instruction Cache", true, [&](auto value) {
+    cache.setEnabled(value);
+  });
+  instructionCache->setDynamic(true);
+
   debugger.load(node);
 }
 
 auto SA1::unload() -> void {
   debugger = {};
+  instructionCache = {};
   node = {};
 
   rom.reset();
@@ -131,6 +137,7 @@ inline auto SA1::triggerIRQ() -> void {
 
 auto SA1::power() -> void {
   WDC65816::power();
+  cache.setEnabled(instructionCache->value());
 
   Thread::create(system.cpuFrequency(), {&SA1::main, this});
   cpu.coprocessors.append(this);
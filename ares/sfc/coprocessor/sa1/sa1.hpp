@@ -2,6 +2,7 @@
 
 struct SA1 : WDC65816, Thread {
   Node::Object node;
+  Node::Setting::Boolean instructionCache;
 
   struct Debugger {
     //debugger.cpp
@@ -57,6 +58,8 @@ struct SA1 : WDC65816, Thread {
   auto write(n24 address, n8 data) -> void override;
   auto readVBR(n24 address, n8 data = 0) -> n8;
   auto readDisassembler(n24 address) -> n8 override;
+  auto fetchable(n24 address) -> const n8* override;
+  auto fetched(n24 address, n8 data) -> void override;
 
   //io.cpp
   auto readIOCPU(n24 address, n8 data) -> n8;
@@ -80,6 +83,8 @@ struct SA1 : WDC65816, Thread {
 
     auto readSA1(n24 address, n8 data = 0) -> n8;
     auto writeSA1(n24 address, n8 data) -> void;
+
+    auto offsetSA1(n24 address) const -> maybe<u32>;
   } rom;
 
   struct BWRAM : WritableMemory {
@@ -52,6 +52,7 @@ auto SuperFX::readIO(n24 address, n8) -> n8 {
 
 auto SuperFX::writeIO(n24 address, n8 data) -> void {
   cpu.synchronize(*this);
+  if constexpr(Accuracy::Recompiler) recompiler.yield();
   address = 0x3000 | address.bit(0,9);
 
   if(address >= 0x3100 && address <= 0x32ff) {
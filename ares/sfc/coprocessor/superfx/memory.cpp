@@ -70,6 +70,20 @@ auto SuperFX::readOpcode(n16 address) -> n8 {
   }
 }
 
+//returns the opcode that readOpcode() would, without stepping or filling the cache
+auto SuperFX::peekOpcode(n16 address) -> n8 {
+  n16 offset = address - regs.cbr;
+  if(offset < 512 && cache.valid[offset >> 4]) return cache.buffer[offset];
+
+  n24 location = regs.pbr << 16 | address;
+  if((location & 0xc00000) == 0x000000) {
+    return rom.read((((location & 0x3f0000) >> 1) | (location & 0x7fff)) & romMask);
+  }
+  if((location & 0xe00000) == 0x400000) return rom.read(location & romMask);
+  if((location & 0xfe0000) == 0x700000) return ram.read(location & ramMask);
+  return 0x00;
+}
+
 inline auto SuperFX::peekpipe() -> n8 {
   n8 result = regs.pipeline;
   regs.pipeline = readOpcode(regs.r[15]);
@@ -28,9 +28,17 @@ auto SuperFX::unload() -> void {
 auto SuperFX::main() -> void {
   if(regs.sfr.g == 0) return step(6);
 
-  auto opcode = peekpipe();
-  debugger.instruction();
-  instruction(opcode);
+  //the recompiler leaves the final instruction of each block for the code below to complete
+  bool recompiled = false;
+  if constexpr(Accuracy::Recompiler) {
+    if(!debugger.tracer.instruction->enabled()) recompiled = recompiler.execute();
+  }
+
+  if(!recompiled) {
+    auto opcode = peekpipe();
+    debugger.instruction();
+    instruction(opcode);
+  }
 
   if(regs.r[14].modified) {
     regs.r[14].modified = false;
@@ -67,6 +75,10 @@ auto SuperFX::power() -> void {
   romMask = romSizeRound(rom.size()) - 1;
   ramMask = ram.size() - 1;
   bramMask = bram.size() - 1;
+  if constexpr(Accuracy::Recompiler) {
+    recompiler.ram = ram.size() ? (u8*)ram.data() : nullptr;
+    recompiler.ramMask = ramMask;
+  }
 
   for(u32 n : range(512)) cache.buffer[n] = 0x00;
   for(u32 n : range(32)) cache.valid[n] = false;
@@ -25,6 +25,7 @@ struct SuperFX : GSU, Thread {
   auto unload() -> void;
 
   auto main() -> void;
+  auto synchronizing() const -> bool override { return scheduler.synchronizing(); }
   auto power() -> void;
 
   //bus.cpp
@@ -61,7 +62,8 @@ struct SuperFX : GSU, Thread {
   auto read(n24 address, n8 data = 0x00) -> n8 override;
   auto write(n24 address, n8 data) -> void override;
 
-  auto readOpcode(n16 address) -> n8;
+  auto readOpcode(n16 address) -> n8 override;
+  auto peekOpcode(n16 address) -> n8 override;
   auto peekpipe() -> n8;
   auto pipe() -> n8 override;
 
@@ -75,6 +77,7 @@ struct SuperFX : GSU, Thread {
 
   //timing.cpp
   auto step(u32 clocks) -> void override;
+  auto budget() const -> u32 override;
 
   auto syncROMBuffer() -> void override;
   auto readROMBuffer() -> n8 override;
@@ -18,6 +18,12 @@ auto SuperFX::step(u32 clocks) -> void {
   Thread::synchronize(cpu);
 }
 
+//clocks that step() may be passed before it must switch to the S-CPU
+auto SuperFX::budget() const -> u32 {
+  if(cpu.clock() <= clock()) return 0;
+  return min((cpu.clock() - clock()) / scalar(), (u64)0xffff'ffff);
+}
+
 auto SuperFX::syncROMBuffer() -> void {
   if(regs.romcl) step(regs.romcl);
 }
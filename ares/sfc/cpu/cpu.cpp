@@ -17,11 +17,23 @@ auto CPU::load(Node::Object parent) -> void {
   version = parent->append<Node::Setting::Natural>("Version", 2);
   version->setAllowedValues({1, 2});
 
+  idleLoops = node->append<Node::Setting::Boolean>("Skip Idle Loops", false, [&](auto value) {
+    idleLoop.setEnabled(value);
+  });
+  idleLoops->setDynamic(true);
+
+  instructionCache = node->append<Node::Setting::Boolean>("Instruction Cache", true, [&](auto value) {
+    cache.setEnabled(value);
+  });
+  instructionCache->setDynamic(true);
+
   debugger.load(node);
 }
 
 auto CPU::unload() -> void {
   version = {};
+  idleLoops = {};
+  instructionCache = {};
   debugger = {};
   node = {};
 }
@@ -61,8 +73,8 @@ auto CPU::main() -> void {
 }
 
 auto CPU::map() -> void {
-  function<n8   (n24, n8)> reader;
-  function<void (n24, n8)> writer;
+  inline_function<n8   (n24, n8)> reader;
+  inline_function<void (n24, n8)> writer;
 
   reader = {&CPU::readRAM, this};
   writer = {&CPU::writeRAM, this};
@@ -84,6 +96,8 @@ auto CPU::map() -> void {
 
 auto CPU::power(bool reset) -> void {
   WDC65816::power();
+  idleLoop.setEnabled(idleLoops->value());
+  cache.setEnabled(instructionCache->value());
   create(system.cpuFrequency(), {&CPU::main, this});
   coprocessors.reset();
   PPUcounter::reset();
@@ -1,6 +1,8 @@
 struct CPU : WDC65816, Thread, PPUcounter {
   Node::Object node;
   Node::Setting::Natural version;
+  Node::Setting::Boolean idleLoops;
+  Node::Setting::Boolean instructionCache;
 
   struct Debugger {
     //debugger.cpp
@@ -49,6 +51,9 @@ struct CPU : WDC65816, Thread, PPUcounter {
   auto write(n24 address, n8 data) -> void override;
   auto wait(n24 address) const -> u32;
   auto readDisassembler(n24 address) -> n8 override;
+  auto idleLoopDetected() -> u32 override;
+  auto fetchable(n24 address) -> const n8* override;
+  auto fetched(n24 address, n8 data) -> void override;
 
   //io.cpp
   auto readRAM(n24 address, n8 data) -> n8;
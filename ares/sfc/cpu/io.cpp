@@ -94,7 +94,7 @@ auto CPU::writeRAM(n24 address, n8 data) -> void {
 }
 
 auto CPU::writeAPU(n24 address, n8 data) -> void {
-  synchronize(smp);
+  if(smp.portPending(address.bit(0,1))) synchronize(smp);
   return smp.portWrite(address.bit(0,1), data);
 }
 
@@ -6,6 +6,7 @@ auto CPU::idle() -> void {
 }
 
 auto CPU::read(n24 address) -> n8 {
+  if(idleLoop) idleLoop.reading(address);
   status.clockCount = wait(address);
   dmaEdge();
   r.mar = address;
@@ -19,6 +20,7 @@ auto CPU::read(n24 address) -> n8 {
 }
 
 auto CPU::write(n24 address, n8 data) -> void {
+  if(idleLoop) idleLoop.writing();
   aluEdge();
   status.clockCount = wait(address);
   dmaEdge();
@@ -41,6 +43,48 @@ alwaysinline auto CPU::wait(n24 address) const -> u32 {
   return 12;
 }
 
+auto CPU::fetchable(n24 address) -> const n8* {
+  return bus.code(address, InstructionCache::Bytes);
+}
+
+//read() from cartridge ROM, which has already been read from the instruction cache.
+auto CPU::fetched(n24 address, n8 data) -> void {
+  if(idleLoop) idleLoop.reading(address);
+  status.clockCount = wait(address);
+  dmaEdge();
+  r.mar = address;
+  step(status.clockCount - 4);
+  step(4);
+  aluEdge();
+  r.mdr = data;
+}
+
 auto CPU::readDisassembler(n24 address) -> n8 {
   return bus.read(address, r.mdr);
 }
+
+//S-CPU polling loops usually wait on HVBJOY, or on a WRAM flag set by the NMI handler.
+auto CPU::idleLoopDetected() -> u32 {
+  //only WRAM and HVBJOY can be read without side effects
+  auto peek = [&](u32 address) -> maybe<u32> {
+    if((address & 0xfe0000) == 0x7e0000) return (u32)wram[address & 0x1ffff];
+    if((address & 0x40e000) == 0x000000) return (u32)wram[address & 0x01fff];
+    if((address & 0x40ffff) == 0x004212) return (u32)readCPU(address, r.mdr);
+    return nothing;
+  };
+
+  //DMA and the ALU advance on CPU cycles rather than on step()
+  if(status.dmaPending || status.hdmaPending || alu.mpyctr || alu.divctr) return 0;
+  u32 clocks = idleLoop.elapsed(clock()) / Thread::scalar();
+  if(!clocks || !idleLoop.sample(peek)) return 0;
+  u32 iterations = 0;
+  while(iterations < IdleLoop::Iterations) {
+    step(clocks);
+    iterations++;
+    if(status.nmiTransition || status.irqTransition || r.irq) break;
+    if(status.dmaPending || status.hdmaPending) break;
+    if(scheduler.synchronizing() || !idleLoop.unchanged(peek)) break;
+  }
+  idleLoop.elapsed(clock());
+  return iterations;
+}
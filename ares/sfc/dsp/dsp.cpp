@@ -186,7 +186,11 @@ auto DSP::main() -> void {
 
 auto DSP::tick() -> void {
   Thread::step(3 * 8);
+#if defined(PROFILE_RELAXED)
+  if(Thread::clock() >= smp.clock() + SMP::Slice) Thread::synchronize(smp);
+#else
   Thread::synchronize(smp);
+#endif
 }
 
 auto DSP::sample(i16 left, i16 right) -> void {
@@ -30,3 +30,14 @@ alwaysinline auto Bus::read(n24 address, n8 data) -> n8 {
 alwaysinline auto Bus::write(n24 address, n8 data) -> void {
   return writer[lookup[address]](target[address], data);
 }
+
+//returns the bytes at [address, address + size) when they are contiguous read-only memory.
+alwaysinline auto Bus::code(n24 address, u32 size) const -> const n8* {
+  u32 id = lookup[address];
+  if(!memory[id]) return nullptr;
+  u32 offset = target[address];
+  for(u32 n : range(1, size)) {
+    if(lookup[address + n] != id || target[address + n] != offset + n) return nullptr;
+  }
+  return memory[id] + offset;
+}
@@ -13,6 +13,7 @@ auto Bus::reset() -> void {
   for(auto id : range(256)) {
     reader[id].reset();
     writer[id].reset();
+    memory[id] = nullptr;
     counter[id] = 0;
   }
 
@@ -30,8 +31,8 @@ auto Bus::reset() -> void {
 }
 
 auto Bus::map(
-  const function<n8   (n24, n8)>& read,
-  const function<void (n24, n8)>& write,
+  const inline_function<n8   (n24, n8)>& read,
+  const inline_function<void (n24, n8)>& write,
   const string& addr, u32 size, u32 base, u32 mask
 ) -> u32 {
   u32 id = 1;
@@ -41,6 +42,7 @@ auto Bus::map(
 
   reader[id] = read;
   writer[id] = write;
+  memory[id] = nullptr;
 
   auto p = addr.split(":", 1L);
   auto banks = p(0).split(",");
@@ -60,6 +62,7 @@ auto Bus::map(
           if(pid && --counter[pid] == 0) {
             reader[pid].reset();
             writer[pid].reset();
+            memory[pid] = nullptr;
           }
 
           u32 offset = reduce(bank << 16 | addr, mask);
@@ -76,6 +79,11 @@ auto Bus::map(
   return id;
 }
 
+//marks a mapping as plain read-only memory, which the CPU may fetch code from directly.
+auto Bus::direct(u32 id, const n8* data) -> void {
+  if(id) memory[id] = data;
+}
+
 auto Bus::unmap(const string& addr) -> void {
   auto p = addr.split(":", 1L);
   auto banks = p(0).split(",");
@@ -95,6 +103,7 @@ auto Bus::unmap(const string& addr) -> void {
           if(pid && --counter[pid] == 0) {
             reader[pid].reset();
             writer[pid].reset();
+            memory[pid] = nullptr;
           }
 
           lookup[bank << 16 | addr] = 0;
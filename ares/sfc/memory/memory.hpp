@@ -32,22 +32,25 @@ struct Bus {
   //inline.hpp
   auto read(n24 address, n8 data) -> n8;
   auto write(n24 address, n8 data) -> void;
+  auto code(n24 address, u32 size) const -> const n8*;
 
   //memory.cpp
   auto reset() -> void;
   auto map(
-    const function<n8   (n24, n8)>& read,
-    const function<void (n24, n8)>& write,
+    const inline_function<n8   (n24, n8)>& read,
+    const inline_function<void (n24, n8)>& write,
     const string& address, u32 size = 0, u32 base = 0, u32 mask = 0
   ) -> u32;
   auto unmap(const string& address) -> void;
+  auto direct(u32 id, const n8* data) -> void;
 
 private:
   n8*  lookup = nullptr;
   n32* target = nullptr;
 
-  function<n8   (n24, n8)> reader[256];
-  function<void (n24, n8)> writer[256];
+  inline_function<n8   (n24, n8)> reader[256];
+  inline_function<void (n24, n8)> writer[256];
+  const n8* memory[256];  //read-only memory that may be read without calling reader
   n24 counter[256];
 };
 
@@ -81,8 +81,8 @@ auto PPU::unload() -> void {
 }
 
 auto PPU::map() -> void {
-  function<n8   (n24, n8)> reader{&PPU::readIO, this};
-  function<void (n24, n8)> writer{&PPU::writeIO, this};
+  inline_function<n8   (n24, n8)> reader{&PPU::readIO, this};
+  inline_function<void (n24, n8)> writer{&PPU::writeIO, this};
   bus.map(reader, writer, "00-3f,80-bf:2100-213f");
 }
 
@@ -1,16 +1,59 @@
 auto SMP::portRead(n2 port) const -> n8 {
-  if(port == 0) return io.cpu0;
-  if(port == 1) return io.cpu1;
-  if(port == 2) return io.cpu2;
-  if(port == 3) return io.cpu3;
+  if(port == 0) return cpuLatch.read(0, io.cpu0, cpu.clock());
+  if(port == 1) return cpuLatch.read(1, io.cpu1, cpu.clock());
+  if(port == 2) return cpuLatch.read(2, io.cpu2, cpu.clock());
+  if(port == 3) return cpuLatch.read(3, io.cpu3, cpu.clock());
   unreachable;
 }
 
+//returns true when the SMP must catch up to the S-CPU before the S-CPU may write to the port.
+auto SMP::portPending(n2 port) const -> bool {
+  return apuLatch.pending(port, clock());
+}
+
 auto SMP::portWrite(n2 port, n8 data) -> void {
-  if(port == 0) io.apu0 = data;
-  if(port == 1) io.apu1 = data;
-  if(port == 2) io.apu2 = data;
-  if(port == 3) io.apu3 = data;
+  if(port == 0) { apuLatch.write(0, io.apu0, cpu.clock()); io.apu0 = data; }
+  if(port == 1) { apuLatch.write(1, io.apu1, cpu.clock()); io.apu1 = data; }
+  if(port == 2) { apuLatch.write(2, io.apu2, cpu.clock()); io.apu2 = data; }
+  if(port == 3) { apuLatch.write(3, io.apu3, cpu.clock()); io.apu3 = data; }
+}
+
+//called whenever the scheduler rebases thread clocks, which would invalidate latch timestamps.
+//any writes that have not yet been observed by their reader become visible immediately.
+auto SMP::portSettle() -> void {
+  for(u32 port : range(4)) {
+    apuLatch.settle(port);
+    cpuLatch.settle(port);
+  }
+}
+
+inline auto SMP::Latch::read(n2 port, n8 data, u64 clock) const -> n8 {
+#if defined(PROFILE_RELAXED)
+  if(clock < this->clock[port]) return this->data[port];
+#endif
+  return data;
+}
+
+inline auto SMP::Latch::pending(n2 port, u64 clock) const -> bool {
+#if defined(PROFILE_RELAXED)
+  //only one write per port can be latched: the prior write must be observed first.
+  return clock < this->clock[port];
+#else
+  return true;
+#endif
+}
+
+inline auto SMP::Latch::write(n2 port, n8 data, u64 clock) -> void {
+#if defined(PROFILE_RELAXED)
+  this->data[port] = data;
+  this->clock[port] = clock;
+#endif
+}
+
+inline auto SMP::Latch::settle(n2 port) -> void {
+#if defined(PROFILE_RELAXED)
+  this->clock[port] = 0;
+#endif
 }
 
 inline auto SMP::readIO(n16 address) -> n8 {
@@ -28,23 +71,24 @@ inline auto SMP::readIO(n16 address) -> n8 {
 
   case 0xf3:  //DSPDATA
     //0x80-0xff are read-only mirrors of 0x00-0x7f
+    synchronize(dsp);
     return dsp.read(io.dspAddress);
 
   case 0xf4:  //CPUIO0
     synchronize(cpu);
-    return io.apu0;
+    return apuLatch.read(0, io.apu0, clock());
 
   case 0xf5:  //CPUIO1
     synchronize(cpu);
-    return io.apu1;
+    return apuLatch.read(1, io.apu1, clock());
 
   case 0xf6:  //CPUIO2
     synchronize(cpu);
-    return io.apu2;
+    return apuLatch.read(2, io.apu2, clock());
 
   case 0xf7:  //CPUIO3
     synchronize(cpu);
-    return io.apu3;
+    return apuLatch.read(3, io.apu3, clock());
 
   case 0xf8:  //AUXIO4
     return io.aux4;
@@ -114,12 +158,16 @@ inline auto SMP::writeIO(n16 address, n8 data) -> void {
       synchronize(cpu);
       io.apu0 = 0x00;
       io.apu1 = 0x00;
+      apuLatch.settle(0);
+      apuLatch.settle(1);
     }
 
     if(data.bit(5)) {
       synchronize(cpu);
       io.apu2 = 0x00;
       io.apu3 = 0x00;
+      apuLatch.settle(2);
+      apuLatch.settle(3);
     }
 
     io.iplromEnable = data.bit(7);
@@ -131,26 +179,31 @@ inline auto SMP::writeIO(n16 address, n8 data) -> void {
 
   case 0xf3:  //DSPDATA
     if(io.dspAddress.bit(7)) break;  //0x80-0xff are read-only mirrors of 0x00-0x7f
+    synchronize(dsp);
     dsp.write(io.dspAddress, data);
     break;
 
   case 0xf4:  //CPUIO0
-    synchronize(cpu);
+    if(cpuLatch.pending(0, cpu.clock())) synchronize(cpu);
+    cpuLatch.write(0, io.cpu0, clock());
     io.cpu0 = data;
     break;
 
   case 0xf5:  //CPUIO1
-    synchronize(cpu);
+    if(cpuLatch.pending(1, cpu.clock())) synchronize(cpu);
+    cpuLatch.write(1, io.cpu1, clock());
     io.cpu1 = data;
     break;
 
   case 0xf6:  //CPUIO2
-    synchronize(cpu);
+    if(cpuLatch.pending(2, cpu.clock())) synchronize(cpu);
+    cpuLatch.write(2, io.cpu2, clock());
     io.cpu2 = data;
     break;
 
   case 0xf7:  //CPUIO3
-    synchronize(cpu);
+    if(cpuLatch.pending(3, cpu.clock())) synchronize(cpu);
+    cpuLatch.write(3, io.cpu3, clock());
     io.cpu3 = data;
     break;
 
@@ -29,6 +29,9 @@ auto SMP::serialize(serializer& s) -> void {
   s(io.aux4);
   s(io.aux5);
 
+  s(apuLatch);
+  s(cpuLatch);
+
   s(timer0);
   s(timer1);
   s(timer2);
@@ -44,3 +47,10 @@ auto SMP::Timer<Frequency>::serialize(serializer& s) -> void {
   s(enable);
   s(target);
 }
+
+auto SMP::Latch::serialize(serializer& s) -> void {
+#if defined(PROFILE_RELAXED)
+  s(data);
+  s(clock);
+#endif
+}
@@ -40,6 +40,8 @@ auto SMP::power(bool reset) -> void {
   r.pc.byte.h = iplrom[63];
 
   io = {};
+  apuLatch = Latch{};
+  cpuLatch = Latch{};
   timer0 = {};
   timer1 = {};
   timer2 = {};
@@ -24,13 +24,22 @@ struct SMP : SPC700, Thread {
 
   //io.cpp
   auto portRead(n2 port) const -> n8;
+  auto portPending(n2 port) const -> bool;
   auto portWrite(n2 port, n8 data) -> void;
+  auto portSettle() -> void;
 
   //serialization.cpp
   auto serialize(serializer&) -> void;
 
   n8 iplrom[64];
 
+#if defined(PROFILE_RELAXED)
+  //the SMP and DSP may run ahead of the threads they share state with by this much time.
+  //two DSP samples (~62.5us) is short enough not to be audible, yet long enough to
+  //avoid nearly all of the context switching incurred by cycle-level synchronization.
+  static constexpr u64 Slice = Second / 16'000;
+#endif
+
 private:
   struct IO {
     //timing
@@ -82,6 +91,29 @@ private:
   auto readIO(n16 address) -> n8;
   auto writeIO(n16 address, n8 data) -> void;
 
+  //relaxed synchronization allows the writer of a port to run ahead of its reader.
+  //each port then remembers its value prior to the last write and the time of that write,
+  //so that the reader does not observe the write until its own clock has caught up to it.
+  //in accurate builds, latching is disabled and every port access synchronizes instead.
+  struct Latch {
+    //io.cpp
+    auto read(n2 port, n8 data, u64 clock) const -> n8;
+    auto pending(n2 port, u64 clock) const -> bool;
+    auto write(n2 port, n8 data, u64 clock) -> void;
+    auto settle(n2 port) -> void;
+
+    //serialization.cpp
+    auto serialize(serializer&) -> void;
+
+  #if defined(PROFILE_RELAXED)
+    n8  data[4] = {};
+    u64 clock[4] = {};
+  #endif
+  };
+
+  Latch apuLatch;  //S-CPU -> SMP
+  Latch cpuLatch;  //SMP -> S-CPU
+
   template<u32 Frequency>
   struct Timer {
     n8 stage0;
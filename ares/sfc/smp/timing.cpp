@@ -21,8 +21,15 @@ inline auto SMP::wait(bool halve, maybe<n16> address) -> void {
 
 inline auto SMP::step(u32 clocks) -> void {
   Thread::step(clocks);
+#if defined(PROFILE_RELAXED)
+  //run ahead of the S-CPU and DSP by up to one time slice before yielding to them.
+  //port and DSP register accesses still synchronize when they need to.
+  if(clock() >= cpu.clock() + Slice) Thread::synchronize(cpu);
+  if(clock() >= dsp.Thread::clock() + Slice) Thread::synchronize(dsp);
+#else
   Thread::synchronize(cpu);
   Thread::synchronize(dsp);
+#endif
 }
 
 inline auto SMP::stepTimers(u32 clocks) -> void {
@@ -1,7 +1,13 @@
+#if defined(PROFILE_RELAXED)
+//the relaxed profile also serializes the S-CPU <> SMP port latches
+static const string SerializerVersion = "v131.1-relaxed";
+#else
 static const string SerializerVersion = "v131";
+#endif
 
 auto System::serialize(bool synchronize) -> serializer {
   if(synchronize) scheduler.enter(Scheduler::Mode::Synchronize);
+  if(synchronize) smp.portSettle();
   serializer s;
 
   u32  signature = SerializerSignature;
@@ -20,7 +20,7 @@ auto option(string name, string value) -> bool {
 }
 
 Random random;
-Scheduler scheduler;
+instance_local Scheduler scheduler;
 System system;
 #include "controls.cpp"
 #include "serialization.cpp"
@@ -57,6 +57,7 @@ auto System::game() -> string {
 
 auto System::run() -> void {
   scheduler.enter();
+  smp.portSettle();
   auto reset = controls.reset->value();
   controls.poll();
   if(!reset && controls.reset->value()) power(true);
@@ -128,6 +129,9 @@ auto System::power(bool reset) -> void {
 
   random.entropy(Random::Entropy::Low);
 
+  if constexpr(GSU::Accuracy::Recompiler) {
+    ares::Memory::FixedAllocator::get().release();
+  }
   cpu.power(reset);
   smp.power(reset);
   dsp.power(reset);
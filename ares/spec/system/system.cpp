@@ -2,7 +2,7 @@
 
 namespace ares::ZXSpectrum {
 
-Scheduler scheduler;
+instance_local Scheduler scheduler;
 ROM rom;
 System system;
 #include "serialization.cpp"
@@ -24,7 +24,7 @@ auto option(string name, string value) -> bool {
   return true;
 }
 
-Scheduler scheduler;
+instance_local Scheduler scheduler;
 System system;
 #define Model ares::WonderSwan::Model
 #define SoC ares::WonderSwan::SoC
@@ -9,6 +9,8 @@ using namespace hiro;
 
 #include <nall/instance.hpp>
 #include <nall/encode/png.hpp>
+#include <nall/encode/rle.hpp>
+#include <nall/decode/rle.hpp>
 #include <nall/hash/crc16.hpp>
 
 namespace ruby {
@@ -82,6 +82,12 @@ auto InputManager::createHotkeys() -> void {
     program.requestScreenshot = true;
   }));
 
+  hotkeys.append(InputHotkey("Toggle Recording").onPress([&] {
+    if(!emulator) return;
+    if(program.capture.active) program.captureStop();
+    else program.captureStart();
+  }));
+
   hotkeys.append(InputHotkey("Save State").onPress([&] {
     if(!emulator) return;
     program.stateSave(program.state.slot);
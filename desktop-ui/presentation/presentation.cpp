@@ -161,6 +161,10 @@ Presentation::Presentation() {
   captureScreenshot.setText("Capture Screenshot").setIcon(Icon::Emblem::Image).onActivate([&] {
     program.requestScreenshot = true;
   });
+  recordVideo.setText("Record Video").onToggle([&] {
+    if(!recordVideo.checked()) return program.captureStop();
+    if(!program.captureStart()) recordVideo.setChecked(false);
+  });
   pauseEmulation.setText("Pause Emulation").onToggle([&] {
     program.pause(!program.paused);
   });
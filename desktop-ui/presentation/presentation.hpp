@@ -55,6 +55,7 @@ struct Presentation : Window {
       MenuItem undoSaveStateMenu{&toolsMenu};
       MenuItem undoLoadStateMenu{&toolsMenu};
       MenuItem captureScreenshot{&toolsMenu};
+      MenuCheckItem recordVideo{&toolsMenu};
       MenuSeparator toolsMenuSeparatorA{&toolsMenu};
       MenuCheckItem pauseEmulation{&toolsMenu};
       MenuItem frameAdvance{&toolsMenu};
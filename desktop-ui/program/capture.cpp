@@ -0,0 +1,199 @@
+//gameplay recording: Program::video() and Program::audio() copy frames and samples into preallocated slots,
+//which a background thread converts and writes out as a Y4M video file and a WAV audio file.
+//the emulator never waits on the writer: when no slot is free, the frame or samples are dropped and counted,
+//and the writer repeats the previous frame (or emits silence) in their place so that audio and video stay aligned.
+
+auto Program::captureStart() -> bool {
+  if(!emulator || capture.active) return false;
+
+  auto datetime = chrono::local::datetime().transform(":", "-");
+  capture.location = emulator->locate({Location::notsuffix(emulator->game->location), " ", datetime, ".y4m"}, ".y4m", settings.paths.screenshots);
+  capture.location = Location::notsuffix(capture.location);
+  capture.frequency = ruby::audio.frequency();
+
+  capture.freeFrames.flush();
+  capture.pendingFrames.flush();
+  capture.freeBlocks.flush();
+  capture.pendingBlocks.flush();
+  for(u32 index : range(Capture::Frames)) capture.freeFrames.write(index);
+  for(u32 index : range(Capture::Blocks)) capture.freeBlocks.write(index);
+  capture.framesDropped = 0;
+  capture.samplesDropped = 0;
+  capture.block.reset();
+  capture.videoFrames = 0;
+  capture.videoDropped = 0;
+  capture.audioSamples = 0;
+  capture.audioDropped = 0;
+
+  capture.active = true;
+  capture.thread = nall::thread::create({&Program::captureMain, this});
+  presentation.recordVideo.setChecked(true);
+  showMessage("Recording started");
+  return true;
+}
+
+auto Program::captureStop() -> void {
+  if(!capture.active) return;
+
+  //hand over the final, partially filled audio block
+  if(capture.block) capture.pendingBlocks.write(capture.block());
+  capture.block.reset();
+  capture.active = false;
+  capture.thread.join();
+
+  presentation.recordVideo.setChecked(false);
+  showMessage({"Recorded ", capture.videoFrames.load(), " frames (", capture.videoDropped.load(), " dropped) and ",
+    capture.audioSamples.load(), " samples (", capture.audioDropped.load(), " dropped)"});
+}
+
+auto Program::captureVideo(const u32* data, u32 pitch, u32 width, u32 height) -> void {
+  if(!capture.active) return;
+  capture.videoFrames++;
+
+  auto index = capture.freeFrames.read();
+  if(!index) {
+    capture.framesDropped++;
+    capture.videoDropped++;
+    return;
+  }
+
+  auto& frame = capture.frames[index()];
+  frame.width = width;
+  frame.height = height;
+  frame.dropped = capture.framesDropped;
+  frame.pixels.resize(width * height);
+  for(u32 y : range(height)) {
+    memory::copy<u32>(frame.pixels.data() + y * width, data + y * (pitch >> 2), width);
+  }
+  capture.framesDropped = 0;
+  capture.pendingFrames.write(index());
+}
+
+auto Program::captureAudio(const f64 samples[2]) -> void {
+  if(!capture.active) return;
+  capture.audioSamples++;
+
+  if(!capture.block) {
+    capture.block = capture.freeBlocks.read();
+    if(!capture.block) {
+      capture.samplesDropped++;
+      capture.audioDropped++;
+      return;
+    }
+    auto& block = capture.blocks[capture.block()];
+    block.size = 0;
+    block.dropped = capture.samplesDropped;
+    capture.samplesDropped = 0;
+  }
+
+  auto& block = capture.blocks[capture.block()];
+  block.samples[block.size * 2 + 0] = sclamp<16>(samples[0] * 32767.0);
+  block.samples[block.size * 2 + 1] = sclamp<16>(samples[1] * 32767.0);
+  if(++block.size == Capture::BlockSamples) {
+    capture.pendingBlocks.write(capture.block());
+    capture.block.reset();
+  }
+}
+
+auto Program::captureMain(uintptr_t) -> void {
+  //the RIFF and data chunk sizes are filled in once recording ends
+  file_buffer audio{{capture.location, ".wav"}, file::mode::write};
+  audio.writes("RIFF");
+  audio.writel(0, 4);
+  audio.writes("WAVE");
+  audio.writes("fmt ");
+  audio.writel(16, 4);
+  audio.writel(1, 2);  //PCM
+  audio.writel(2, 2);  //channels
+  audio.writel(capture.frequency, 4);
+  audio.writel(capture.frequency * 4, 4);
+  audio.writel(4, 2);  //block alignment
+  audio.writel(16, 2);  //bits per sample
+  audio.writes("data");
+  audio.writel(0, 4);
+
+  //a new video file is started whenever the frame size changes, as Y4M cannot change size mid-stream.
+  //the frame rate is written as a fixed-width placeholder, then replaced by the rate measured against the audio clock.
+  file_buffer video;
+  u32 segment = 0;
+  u32 width = 0;
+  u32 height = 0;
+  u64 rateOffset = 0;
+  vector<u8> planes;  //Y, Cb and Cr planes of the most recently written frame
+
+  auto closeVideo = [&] {
+    if(!video) return;
+    if(auto samples = capture.audioSamples.load()) {
+      u64 rate = capture.videoFrames * capture.frequency * 1'000'000ull / samples;
+      video.seek(rateOffset);
+      video.writes(pad(min(rate, 9'999'999'999ull), 10, '0'));
+    }
+    video.close();
+  };
+
+  while(true) {
+    bool idle = true;
+
+    while(auto index = capture.pendingFrames.read()) {
+      idle = false;
+      auto& frame = capture.frames[index()];
+
+      for(u32 repeat : range(planes ? frame.dropped : 0)) {
+        video.writes("FRAME\n");
+        video.write({planes.data(), planes.size()});
+      }
+
+      if(!video || frame.width != width || frame.height != height) {
+        closeVideo();
+        width = frame.width;
+        height = frame.height;
+        string name{capture.location, segment++ ? string{"-", segment} : string{}, ".y4m"};
+        video.open(name, file::mode::write);
+        string header{"YUV4MPEG2 W", width, " H", height, " F"};
+        rateOffset = header.size();
+        header.append("0060000000:1000000 Ip A1:1 C444 XCOLORRANGE=FULL\n");
+        video.writes(header);
+        planes.resize(width * height * 3);
+      }
+
+      //full-range BT.601 conversion, without chroma subsampling
+      auto Y  = planes.data();
+      auto Cb = Y  + width * height;
+      auto Cr = Cb + width * height;
+      for(u32 n : range(width * height)) {
+        u32 color = frame.pixels[n];
+        s32 r = color >> 16 & 255;
+        s32 g = color >>  8 & 255;
+        s32 b = color >>  0 & 255;
+        Y [n] = ( 77 * r + 150 * g +  29 * b + 128) >> 8;
+        Cb[n] = max(0, min(255, ((-43 * r -  85 * g + 128 * b + 128) >> 8) + 128));
+        Cr[n] = max(0, min(255, ((128 * r - 107 * g -  21 * b + 128) >> 8) + 128));
+      }
+      capture.freeFrames.write(index());
+
+      video.writes("FRAME\n");
+      video.write({planes.data(), planes.size()});
+    }
+
+    while(auto index = capture.pendingBlocks.read()) {
+      idle = false;
+      auto& block = capture.blocks[index()];
+      for(u32 n : range(block.dropped)) audio.writel(0, 4);
+      for(u32 n : range(block.size * 2)) audio.writel((u16)block.samples[n], 2);
+      capture.freeBlocks.write(index());
+    }
+
+    if(idle) {
+      if(!capture.active) break;
+      usleep(1000);
+    }
+  }
+
+  closeVideo();
+  u64 size = audio.size();
+  audio.seek(4);
+  audio.writel(size - 8, 4);
+  audio.seek(40);
+  audio.writel(size - 44, 4);
+  audio.close();
+}
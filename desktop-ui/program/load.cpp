@@ -63,6 +63,7 @@ auto Program::load(string location) -> bool {
   streamManager.reload();
   propertiesViewer.reload();
   traceLogger.reload();
+  frameTimingViewer.reload();
   state = {};  //reset hotkey state slot to 1
   if(settings.boot.debugger) {
     pause(true);
@@ -88,6 +89,7 @@ auto Program::load(string location) -> bool {
 auto Program::unload() -> void {
   if(!emulator) return;
 
+  captureStop();
   settings.save();
   clearUndoStates();
   showMessage({"Unloaded ", Location::prefix(emulator->game->location)});
@@ -105,6 +107,7 @@ auto Program::unload() -> void {
   streamManager.unload();
   propertiesViewer.unload();
   traceLogger.unload();
+  frameTimingViewer.unload();
   message.text = "";
   ruby::video.clear();
   ruby::audio.clear();
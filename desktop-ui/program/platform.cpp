@@ -52,14 +52,40 @@ auto Program::status(string_view message) -> void {
   showMessage(message);
 }
 
+//lets the screen render its final pass directly into the video driver's buffer.
+//ruby::video stays locked until the matching Program::video() call.
+auto Program::acquire(ares::Node::Video::Screen node, u32& pitch, u32 width, u32 height) -> u32* {
+  //screenshots and recording read the frame back, which is slow (or undefined) for write-only driver mappings
+  if(!screens || requestScreenshot || capture.active) return nullptr;
+
+  ruby::video.lock();
+  if(auto [output, length] = ruby::video.acquire(width, height); output) {
+    pitch = length;
+    acquiredVideo = output;
+    return output;
+  }
+  ruby::video.unlock();
+  return nullptr;
+}
+
 auto Program::video(ares::Node::Video::Screen node, const u32* data, u32 pitch, u32 width, u32 height) -> void {
-  if(!screens) return;
+  u64 presentBegin = frameTiming.enabled ? chrono::nanosecond() : 0;
+  if(!screens) {
+    if(data == acquiredVideo) {
+      acquiredVideo = nullptr;
+      ruby::video.release();
+      ruby::video.unlock();
+    }
+    return;
+  }
 
-  if(requestScreenshot) {
+  if(requestScreenshot && data != acquiredVideo) {
     requestScreenshot = false;
     captureScreenshot(data, pitch, width, height);
   }
 
+  if(capture.active && data != acquiredVideo) captureVideo(data, pitch, width, height);
+
   if(node->width() != emulator->latch.width || node->height() != emulator->latch.height || node->rotation() != emulator->latch.rotation) {
     emulator->latch.width = node->width();
     emulator->latch.height = node->height();
@@ -106,7 +132,12 @@ auto Program::video(ares::Node::Video::Screen node, const u32* data, u32 pitch,
   }
 
   pitch >>= 2;
-  if(auto [output, length] = ruby::video.acquire(width, height); output) {
+  if(data == acquiredVideo) {
+    acquiredVideo = nullptr;
+    ruby::video.release();
+    ruby::video.output(outputWidth, outputHeight);
+    ruby::video.unlock();  //balances the lock taken in Program::acquire()
+  } else if(auto [output, length] = ruby::video.acquire(width, height); output) {
     length >>= 2;
     for(auto y : range(height)) {
       memory::copy<u32>(output + y * length, data + y * pitch, width);
@@ -115,6 +146,7 @@ auto Program::video(ares::Node::Video::Screen node, const u32* data, u32 pitch,
     ruby::video.output(outputWidth, outputHeight);
   }
   ruby::video.unlock();
+  if(presentBegin) timingPresent(presentBegin);
 
   static u64 frameCounter = 0, previous, current;
   frameCounter++;
@@ -163,6 +195,7 @@ auto Program::audio(ares::Node::Audio::Stream node) -> void {
 
     //send frame to the audio output device
     ruby::audio.output(samples);
+    if(capture.active) captureAudio(samples);
   }
 }
 
@@ -3,6 +3,8 @@
 #include "load.cpp"
 #include "states.cpp"
 #include "rewind.cpp"
+#include "timing.cpp"
+#include "capture.cpp"
 #include "status.cpp"
 #include "utility.cpp"
 #include "drivers.cpp"
@@ -12,6 +14,10 @@ Program program;
 auto Program::create() -> void {
   ares::platform = this;
 
+  for(u32 index : range(StateWriter::Jobs)) stateWriter.available.write(index);
+  stateWriter.pending.setBlocking(true);
+  stateWriter.thread = nall::thread::create({&Program::stateMain, this});
+
   videoDriverUpdate();
   audioDriverUpdate();
   inputDriverUpdate();
@@ -47,8 +53,10 @@ auto Program::main() -> void {
   }
 
   updateMessage();
+  stateReport();
   inputManager.poll();
   inputManager.pollHotkeys();
+  timingInputPolled();
   bool defocused = driverSettings.inputDefocusPause.checked() && !ruby::video.fullScreen() && !presentation.focused();
   if(emulator && defocused) message.text = "Paused";
   if(!emulator || (paused && !program.requestFrameAdvance) || defocused) {
@@ -60,6 +68,7 @@ auto Program::main() -> void {
   rewindRun();
 
   program.requestFrameAdvance = false;
+  timingEmulateBegin();
   if(!runAhead || fastForwarding || rewinding) {
     emulator->root->run();
   } else {
@@ -71,6 +80,7 @@ auto Program::main() -> void {
     state.setReading();
     emulator->root->unserialize(state);
   }
+  timingEmulateEnd();
 
   if(settings.general.autoSaveMemory) {
     static u64 previousTime = chrono::timestamp();
@@ -91,10 +101,15 @@ auto Program::main() -> void {
   memoryEditor.liveRefresh();
   graphicsViewer.liveRefresh();
   propertiesViewer.liveRefresh();
+  frameTimingViewer.liveRefresh();
 }
 
 auto Program::quit() -> void {
   unload();
+  //write out any queued states before stopping the writer
+  stateFlush();
+  while(!stateWriter.pending.write(StateWriter::Jobs)) usleep(1000);
+  stateWriter.thread.join();
   presentation.setVisible(false);  //makes quitting the emulator feel more responsive
   Application::processEvents();
   Application::quit();
@@ -10,6 +10,7 @@ struct Program : ares::Platform {
   auto event(ares::Event) -> void override;
   auto log(string_view message) -> void override;
   auto status(string_view message) -> void override;
+  auto acquire(ares::Node::Video::Screen, u32& pitch, u32 width, u32 height) -> u32* override;
   auto video(ares::Node::Video::Screen, const u32* data, u32 pitch, u32 width, u32 height) -> void override;
   auto audio(ares::Node::Audio::Stream) -> void override;
   auto input(ares::Node::Input::Input) -> void override;
@@ -26,6 +27,13 @@ struct Program : ares::Platform {
   auto undoStateSave() -> bool;
   auto undoStateLoad() -> bool;
   auto clearUndoStates() -> void;
+  auto stateWrite(serializer state, const string& location, const string& undoLocation, u32 slot) -> void;
+  auto stateFlush() -> void;
+  auto stateReport() -> void;
+  auto stateMain(uintptr_t) -> void;
+  auto stateReplace(const string& source, const string& target) -> bool;
+  auto stateEncode(const serializer& state) -> vector<u8>;
+  auto stateDecode(vector<u8>& buffer) -> bool;
 
   //status.cpp
   auto updateMessage() -> void;
@@ -66,6 +74,7 @@ struct Program : ares::Platform {
   bool runAhead = false;
   bool requestFrameAdvance = false;
   bool requestScreenshot = false;
+  const u32* acquiredVideo = nullptr;
   bool keyboardCaptured = false;
 
   struct State {
@@ -73,6 +82,26 @@ struct Program : ares::Platform {
     u32 undoSlot = 1;
   } state;
 
+  //save states are compressed and written out by a background thread
+  struct StateWriter {
+    static constexpr u32 Jobs = 4;
+
+    struct Job {
+      unique_pointer<serializer> state;
+      string location;
+      string undoLocation;  //when set, the existing file at location is first moved here
+      u32 slot = 0;         //0 for undo states, which are written silently
+      bool moved = false;
+      bool written = false;
+    };
+
+    Job jobs[Jobs];
+    queue_spsc<u32[Jobs]> available;  //Program::stateReport() -> Program::stateWrite()
+    queue_spsc<u32[Jobs]> pending;    //Program::stateWrite() -> writer; Jobs stops the writer
+    queue_spsc<u32[Jobs]> finished;   //writer -> Program::stateReport()
+    nall::thread thread;
+  } stateWriter;
+
   //rewind.cpp
   struct Rewind {
     enum class Mode : u32 { Playing, Rewinding } mode = Mode::Playing;
@@ -85,6 +114,83 @@ struct Program : ares::Platform {
   auto rewindReset() -> void;
   auto rewindRun() -> void;
 
+  //timing.cpp
+  struct FrameTiming {
+    struct Record {
+      u64 frame = 0;       //emulated frame number
+      u64 timestamp = 0;   //nanoseconds since recording began, taken once the frame was presented
+      u32 emulate = 0;     //nanoseconds spent running the emulator for this frame
+      u32 present = 0;     //nanoseconds spent handing the frame to the video driver
+      u32 latency = 0;     //nanoseconds from the most recent input poll to presentation
+      f32 audioLevel = 0;  //audio driver buffer fill: 0.0 (empty) to 1.0 (full)
+      u16 dropped = 0;     //emulated frames that were never presented since the previous record
+      u16 duplicated = 0;  //1 if this frame was already presented
+    };
+
+    atomic<bool> enabled = false;
+    atomic<u64> frame = 0;      //frames emulated since recording began
+    atomic<u64> presented = 0;  //frame number of the most recent presentation
+    atomic<u64> polled = 0;     //timestamp of the most recent input poll
+    atomic<u32> emulate = 0;    //duration of the most recently emulated frame
+    atomic<f32> audioLevel = 0; //audio buffer fill sampled after the most recently emulated frame
+    atomic<bool> drain = false; //set to hand the queue to the writer, which discards stale records
+    atomic<u64> origin = 0;
+    u64 emulateBegin = 0;
+    queue_spsc<Record[4096]> records;  //written by Program::video(), drained by FrameTimingViewer
+  } frameTiming;
+  auto timingSetEnabled(bool) -> void;
+  auto timingInputPolled() -> void;
+  auto timingEmulateBegin() -> void;
+  auto timingEmulateEnd() -> void;
+  auto timingPresent(u64 begin) -> void;
+
+  //capture.cpp
+  struct Capture {
+    static constexpr u32 Frames = 8;            //frames that may be queued before new ones are dropped
+    static constexpr u32 Blocks = 64;           //audio blocks that may be queued before new ones are dropped
+    static constexpr u32 BlockSamples = 1024;  //stereo samples per audio block
+
+    struct Frame {
+      vector<u32> pixels;
+      u32 width = 0;
+      u32 height = 0;
+      u32 dropped = 0;  //frames dropped immediately before this one; the writer repeats the previous frame in their place
+    };
+
+    struct Block {
+      s16 samples[BlockSamples * 2];
+      u32 size = 0;
+      u32 dropped = 0;  //samples dropped immediately before this block; the writer emits silence in their place
+    };
+
+    atomic<bool> active = false;
+    string location;  //path and filename prefix, without the extension
+    u32 frequency = 0;
+    nall::thread thread;
+
+    Frame frames[Frames];
+    Block blocks[Blocks];
+    queue_spsc<u32[Frames]> freeFrames;     //writer -> Program::video()
+    queue_spsc<u32[Frames]> pendingFrames;  //Program::video() -> writer
+    queue_spsc<u32[Blocks]> freeBlocks;     //writer -> Program::audio()
+    queue_spsc<u32[Blocks]> pendingBlocks;  //Program::audio() -> writer
+
+    //producer side: only touched by the thread calling captureVideo() or captureAudio() respectively
+    u32 framesDropped = 0;
+    u32 samplesDropped = 0;
+    maybe<u32> block;
+
+    atomic<u64> videoFrames = 0;
+    atomic<u64> videoDropped = 0;
+    atomic<u64> audioSamples = 0;
+    atomic<u64> audioDropped = 0;
+  } capture;
+  auto captureStart() -> bool;
+  auto captureStop() -> void;
+  auto captureVideo(const u32* data, u32 pitch, u32 width, u32 height) -> void;
+  auto captureAudio(const f64 samples[2]) -> void;
+  auto captureMain(uintptr_t) -> void;
+
   struct Message {
     u64 timestamp = 0;
     string text;
@@ -1,17 +1,21 @@
+//save states are serialized on the emulation thread, and then handed to a background thread
+//that compresses them and writes them out, so that saving does not stall emulation.
+//the files are written under a temporary name and renamed into place once complete.
+
+//compressed save states begin with a 32-byte header, so that they can be validated without decompressing them:
+//"BSTZ", format version, compression method (1 = RLE), state size, payload size, payload CRC32, header CRC32, reserved.
+//all fields are little-endian. files without this header are loaded as uncompressed states.
+static constexpr u32 StateHeaderSize = 32;
+
 auto Program::stateSave(u32 slot) -> bool {
   if(!emulator) return false;
 
   auto location = emulator->locate(emulator->game->location, {".bs", slot}, settings.paths.saves);
   string undoLocation = {location.slice(0, (location.size() - 1)), "u"};
-  if(file::move(location, undoLocation)) {
-    state.undoSlot = slot;
-  }
 
-  if(auto state = emulator->root->serialize()) {
-    if(file::write(location, {state.data(), state.size()})) {
-      showMessage({"Saved state to slot ", slot});
-      return true;
-    }
+  if(auto serialized = emulator->root->serialize()) {
+    stateWrite(std::move(serialized), location, undoLocation, slot);
+    return true;
   }
 
   showMessage({"Failed to save state to slot ", slot});
@@ -20,17 +24,18 @@ auto Program::stateSave(u32 slot) -> bool {
 
 auto Program::stateLoad(u32 slot) -> bool {
   if(!emulator) return false;
+  stateFlush();
 
   //Store current state for undo
   auto undoLocation = emulator->locate(emulator->game->location, {".blu"}, settings.paths.saves);
-  if(auto state = emulator->root->serialize()) {
-    file::write(undoLocation, {state.data(), state.size()});
+  if(auto serialized = emulator->root->serialize()) {
+    stateWrite(std::move(serialized), undoLocation, {}, 0);
   }
 
   auto location = emulator->locate(emulator->game->location, {".bs", slot}, settings.paths.saves);
-  if(auto memory = file::read(location)) {
-    serializer state{memory.data(), (u32)memory.size()};
-    if(emulator->root->unserialize(state)) {
+  if(auto memory = file::read(location); memory && stateDecode(memory)) {
+    serializer serialized{memory.data(), (u32)memory.size()};
+    if(emulator->root->unserialize(serialized)) {
       showMessage({"Loaded state from slot ", slot});
       return true;
     }
@@ -42,6 +47,7 @@ auto Program::stateLoad(u32 slot) -> bool {
 
 auto Program::undoStateSave() -> bool {
   if(!emulator) return false;
+  stateFlush();
 
   auto undoLocation = emulator->locate(emulator->game->location, ".bsu", settings.paths.saves);
   string location = {undoLocation.slice(0, (undoLocation.size() - 1)), state.undoSlot};
@@ -56,11 +62,12 @@ auto Program::undoStateSave() -> bool {
 
 auto Program::undoStateLoad() -> bool {
   if(!emulator) return false;
+  stateFlush();
 
   auto undoLocation = emulator->locate(emulator->game->location, ".blu", settings.paths.saves);
-  if(auto memory = file::read(undoLocation)) {
-    serializer state{memory.data(), (u32)memory.size()};
-    if(emulator->root->unserialize(state)) {
+  if(auto memory = file::read(undoLocation); memory && stateDecode(memory)) {
+    serializer serialized{memory.data(), (u32)memory.size()};
+    if(emulator->root->unserialize(serialized)) {
       showMessage({"Loaded state from undo load file ", undoLocation});
       file::remove(undoLocation);
       return true;
@@ -76,10 +83,113 @@ auto Program::undoStateLoad() -> bool {
 
 auto Program::clearUndoStates() -> void {
   if(!emulator) return;
+  stateFlush();
 
   auto location = emulator->locate(emulator->game->location, ".blu", settings.paths.saves);
   file::remove(location);
 
   location = emulator->locate(emulator->game->location, ".bsu", settings.paths.saves);
   file::remove(location);
-}
\ No newline at end of file
+}
+
+//queues a serialized state to be written to location; ownership of its buffer passes to the writer
+auto Program::stateWrite(serializer serialized, const string& location, const string& undoLocation, u32 slot) -> void {
+  auto index = stateWriter.available.read();
+  if(!index) {
+    stateFlush();
+    index = stateWriter.available.read();
+  }
+
+  auto& job = stateWriter.jobs[index()];
+  job.state = new serializer{std::move(serialized)};
+  job.location = location;
+  job.undoLocation = undoLocation;
+  job.slot = slot;
+  job.moved = false;
+  job.written = false;
+  stateWriter.pending.write(index());
+}
+
+//waits for all queued states to be written, so that their files can be read, moved or removed
+auto Program::stateFlush() -> void {
+  while(true) {
+    stateReport();
+    if(stateWriter.available.full()) return;
+    usleep(1000);
+  }
+}
+
+auto Program::stateReport() -> void {
+  while(auto index = stateWriter.finished.read()) {
+    auto& job = stateWriter.jobs[index()];
+    if(job.moved) state.undoSlot = job.slot;
+    if(job.slot && job.written) showMessage({"Saved state to slot ", job.slot});
+    if(job.slot && !job.written) showMessage({"Failed to save state to slot ", job.slot});
+    stateWriter.available.write(index());
+  }
+}
+
+auto Program::stateMain(uintptr_t) -> void {
+  while(true) {
+    auto index = stateWriter.pending.await_read();
+    if(index == StateWriter::Jobs) break;
+
+    auto& job = stateWriter.jobs[index];
+    if(job.undoLocation) job.moved = file::move(job.location, job.undoLocation);
+    auto output = stateEncode(*job.state);
+    job.state.reset();
+    string temporary = {job.location, ".tmp"};
+    job.written = file::write(temporary, output) && stateReplace(temporary, job.location);
+    if(!job.written) file::remove(temporary);
+    stateWriter.finished.write(index);
+  }
+}
+
+//renames source over target, replacing any existing file in a single step.
+//rename() already does this on POSIX, but fails on Windows when the target exists,
+//where file::move() would then fall back to copying over the previous state.
+auto Program::stateReplace(const string& source, const string& target) -> bool {
+  #if defined(PLATFORM_WINDOWS)
+  return MoveFileExW(utf16_t(source), utf16_t(target), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH);
+  #else
+  return inode::rename(source, target);
+  #endif
+}
+
+auto Program::stateEncode(const serializer& serialized) -> vector<u8> {
+  auto payload = Encode::RLE<1>({serialized.data(), serialized.size()});
+
+  vector<u8> output;
+  output.resize(StateHeaderSize);
+  auto header = output.data();
+  memory::copy(header, "BSTZ", 4);
+  memory::writel<4>(header +  4, 1);  //version
+  memory::writel<4>(header +  8, 1);  //compression
+  memory::writel<4>(header + 12, serialized.size());
+  memory::writel<4>(header + 16, payload.size());
+  memory::writel<4>(header + 20, Hash::CRC32(payload).value());
+  memory::writel<4>(header + 24, Hash::CRC32({header, 24}).value());
+  output.append(payload);
+  return output;
+}
+
+//replaces a compressed state with its uncompressed contents; returns false if the state is damaged
+auto Program::stateDecode(vector<u8>& buffer) -> bool {
+  if(buffer.size() < 4 || memory::compare(buffer.data(), "BSTZ", 4)) return true;
+  if(buffer.size() < StateHeaderSize) return false;
+
+  auto header = buffer.data();
+  if(memory::readl<4>(header + 24) != Hash::CRC32({header, 24}).value()) return false;
+  if(memory::readl<4>(header + 4) != 1) return false;
+  if(memory::readl<4>(header + 8) != 1) return false;
+  u32 size = memory::readl<4>(header + 12);
+  u32 payloadSize = memory::readl<4>(header + 16);
+  if(buffer.size() - StateHeaderSize != payloadSize) return false;
+  array_view<u8> payload{header + StateHeaderSize, payloadSize};
+  if(memory::readl<4>(header + 20) != Hash::CRC32(payload).value()) return false;
+
+  auto output = Decode::RLE<1>(payload);
+  if(output.size() != size) return false;
+  buffer = std::move(output);
+  return true;
+}
@@ -0,0 +1,59 @@
+//frame pacing instrumentation: when enabled, Program::video() produces one Record per presented frame.
+//every hook returns immediately while disabled, so the cost of leaving this compiled in is a few branches per frame.
+
+//Program::video() may be writing a record from another thread, so the queue is not flushed here.
+//instead, the writer is asked to read out the stale records before it writes the next one,
+//and FrameTimingViewer stops reading from the queue until that is done.
+auto Program::timingSetEnabled(bool enabled) -> void {
+  frameTiming.enabled = false;
+  frameTiming.drain = true;
+  frameTiming.frame = 0;
+  frameTiming.presented = 0;
+  frameTiming.emulate = 0;
+  frameTiming.audioLevel = 0;
+  u64 origin = chrono::nanosecond();
+  frameTiming.origin = origin;
+  frameTiming.polled = origin;
+  frameTiming.enabled = enabled;
+}
+
+auto Program::timingInputPolled() -> void {
+  if(!frameTiming.enabled) return;
+  frameTiming.polled = chrono::nanosecond();
+}
+
+auto Program::timingEmulateBegin() -> void {
+  if(!frameTiming.enabled) return;
+  frameTiming.frame++;
+  frameTiming.emulateBegin = chrono::nanosecond();
+}
+
+auto Program::timingEmulateEnd() -> void {
+  if(!frameTiming.enabled) return;
+  frameTiming.emulate = min(chrono::nanosecond() - frameTiming.emulateBegin, (u64)~0u);
+  //the audio driver is only queried from the main thread
+  frameTiming.audioLevel = ruby::audio.level();
+}
+
+//may be called from a screen's refresh thread: only the atomics and the queue are shared with the main thread.
+auto Program::timingPresent(u64 begin) -> void {
+  if(!frameTiming.enabled) return;
+  if(frameTiming.drain) {
+    while(frameTiming.records.read());
+    frameTiming.drain = false;
+  }
+  u64 end = chrono::nanosecond();
+  u64 frame = frameTiming.frame;
+  u64 previous = frameTiming.presented.exchange(frame);
+
+  FrameTiming::Record record;
+  record.frame = frame;
+  record.timestamp = end - frameTiming.origin;
+  record.emulate = frameTiming.emulate;
+  record.present = min(end - begin, (u64)~0u);
+  record.latency = min(end - min(end, (u64)frameTiming.polled), (u64)~0u);
+  record.audioLevel = frameTiming.audioLevel;
+  record.dropped = min(frame > previous + 1 ? frame - previous - 1 : 0, (u64)0xffff);
+  record.duplicated = frame == previous;
+  frameTiming.records.write(record);  //if the viewer falls behind, records are discarded rather than blocking
+}
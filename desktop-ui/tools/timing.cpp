@@ -0,0 +1,147 @@
+auto FrameTimingViewer::construct() -> void {
+  setCollapsible();
+  setVisible(false);
+
+  timingLabel.setText("Frame Timing").setFont(Font().setBold());
+  metricList.append(ComboButtonItem().setText("Frame Interval"));
+  metricList.append(ComboButtonItem().setText("Emulation Time"));
+  metricList.append(ComboButtonItem().setText("Presentation Time"));
+  metricList.append(ComboButtonItem().setText("Input Latency"));
+  metricList.onChange([&] { refresh(); });
+  histogramView.setAlignment({0.0, 0.0});
+  csvButton.setText("Export CSV").onActivate([&] {
+    eventExport(false);
+  });
+  jsonButton.setText("Export JSON").onActivate([&] {
+    eventExport(true);
+  });
+  recordOption.setText("Record").onToggle([&] {
+    eventToggle();
+  });
+  clearButton.setText("Clear").onActivate([&] {
+    history.reset();
+    refresh();
+  });
+}
+
+auto FrameTimingViewer::reload() -> void {
+  history.reset();
+  eventToggle();
+}
+
+auto FrameTimingViewer::unload() -> void {
+  program.timingSetEnabled(false);
+  history.reset();
+  refresh();
+}
+
+//nanoseconds for the selected metric; the frame interval is measured from the previous record
+auto FrameTimingViewer::sample(u32 index) const -> u64 {
+  auto& record = history[index];
+  if(metricList.selected().offset() == 0) return index ? record.timestamp - history[index - 1].timestamp : 0;
+  if(metricList.selected().offset() == 1) return record.emulate;
+  if(metricList.selected().offset() == 2) return record.present;
+  if(metricList.selected().offset() == 3) return record.latency;
+  return 0;
+}
+
+auto FrameTimingViewer::refresh() -> void {
+  refreshed = chrono::millisecond();
+  auto milliseconds = [](u64 nanoseconds) -> string {
+    return {nanoseconds / 1'000'000, ".", pad(nanoseconds / 10'000 % 100, 2, '0')};
+  };
+
+  //0.25ms bins from 0ms to 50ms: anything slower lands in the last bin
+  static constexpr u32 Bins = 200;
+  u32 bins[Bins] = {};
+  vector<u64> samples;
+  u64 total = 0, dropped = 0, duplicated = 0;
+  f64 audioLevel = 0.0;
+  for(u32 index : range(history.size())) {
+    dropped += history[index].dropped;
+    duplicated += history[index].duplicated;
+    audioLevel += history[index].audioLevel;
+    if(index == 0 && metricList.selected().offset() == 0) continue;
+    auto value = sample(index);
+    samples.append(value);
+    total += value;
+    bins[min(value / 250'000, Bins - 1)]++;
+  }
+
+  auto geometry = histogramView.geometry();
+  u32 width  = max(Bins, (u32)geometry.width());
+  u32 height = max(32u, (u32)geometry.height());
+  u32 tallest = 1;
+  for(auto count : bins) tallest = max(tallest, count);
+  image view;
+  view.allocate(width, height);
+  view.fill(255u << 24 | 0x202020);
+  for(u32 bin : range(Bins)) {
+    u32 barHeight = (u64)bins[bin] * (height - 1) / tallest;
+    for(u32 x : range(bin * width / Bins, (bin + 1) * width / Bins - 1)) {
+      for(u32 y : range(height - barHeight, height)) {
+        view.write(view.data() + y * view.pitch() + x * view.stride(), 255u << 24 | 0x4080c0);
+      }
+    }
+  }
+  histogramView.setIcon(view);
+
+  if(!samples) {
+    summaryLabel.setText("No frames recorded (0-50ms, 0.25ms per bar)");
+    return;
+  }
+  samples.sort();
+  summaryLabel.setText({
+    samples.size(), " frames: mean ", milliseconds(total / samples.size()),
+    "ms, 99th percentile ", milliseconds(samples[samples.size() * 99 / 100]),
+    "ms, max ", milliseconds(samples.last()), "ms, ",
+    dropped, " dropped, ", duplicated, " duplicated, audio level ",
+    (u32)(audioLevel * 100.0 / history.size()), "%"
+  });
+}
+
+auto FrameTimingViewer::liveRefresh() -> void {
+  if(!program.frameTiming.enabled || program.frameTiming.drain) return;
+  while(auto record = program.frameTiming.records.read()) history.append(record());
+  if(history.size() >= 2 * History) history.removeLeft(history.size() - History);
+  //the histogram is redrawn a few times per second rather than every frame
+  if(visible() && chrono::millisecond() - refreshed >= 250) refresh();
+}
+
+auto FrameTimingViewer::eventToggle() -> void {
+  program.timingSetEnabled(recordOption.checked());
+}
+
+auto FrameTimingViewer::eventExport(bool json) -> void {
+  if(!emulator || !history) return;
+
+  string output;
+  if(json) {
+    output.append("[\n");
+    for(u32 index : range(history.size())) {
+      auto& record = history[index];
+      output.append("  {\"frame\": ", record.frame, ", \"timestamp\": ", record.timestamp);
+      output.append(", \"emulate\": ", record.emulate, ", \"present\": ", record.present, ", \"latency\": ", record.latency);
+      output.append(", \"audioLevel\": ", record.audioLevel, ", \"dropped\": ", record.dropped, ", \"duplicated\": ", record.duplicated);
+      output.append(index + 1 < history.size() ? "},\n" : "}\n");
+    }
+    output.append("]\n");
+  } else {
+    output.append("frame,timestamp,emulate,present,latency,audioLevel,dropped,duplicated\n");
+    for(auto& record : history) {
+      output.append(record.frame, ",", record.timestamp, ",", record.emulate, ",", record.present, ",", record.latency, ",");
+      output.append(record.audioLevel, ",", record.dropped, ",", record.duplicated, "\n");
+    }
+  }
+
+  auto extension = json ? ".json" : ".csv";
+  auto datetime = chrono::local::datetime().replace("-", "").replace(":", "").replace(" ", "-");
+  auto location = emulator->locate({Location::notsuffix(emulator->game->location), "-timing-", datetime, extension}, extension, settings.paths.debugging);
+  file::write(location, output);
+}
+
+auto FrameTimingViewer::setVisible(bool visible) -> FrameTimingViewer& {
+  if(visible) refresh();
+  VerticalLayout::setVisible(visible);
+  return *this;
+}
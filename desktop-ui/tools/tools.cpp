@@ -5,6 +5,7 @@
 #include "streams.cpp"
 #include "properties.cpp"
 #include "tracer.cpp"
+#include "timing.cpp"
 
 namespace Instances { Instance<ToolsWindow> toolsWindow; }
 ToolsWindow& toolsWindow = Instances::toolsWindow();
@@ -14,6 +15,7 @@ GraphicsViewer& graphicsViewer = toolsWindow.graphicsViewer;
 StreamManager& streamManager = toolsWindow.streamManager;
 PropertiesViewer& propertiesViewer = toolsWindow.propertiesViewer;
 TraceLogger& traceLogger = toolsWindow.traceLogger;
+FrameTimingViewer& frameTimingViewer = toolsWindow.frameTimingViewer;
 
 ToolsWindow::ToolsWindow() {
 
@@ -26,6 +28,7 @@ ToolsWindow::ToolsWindow() {
   panelList.append(ListViewItem().setText("Streams").setIcon(Icon::Emblem::Audio));
   panelList.append(ListViewItem().setText("Properties").setIcon(Icon::Emblem::Text));
   panelList.append(ListViewItem().setText("Tracer").setIcon(Icon::Emblem::Script));
+  panelList.append(ListViewItem().setText("Timing").setIcon(Icon::Device::Clock));
   panelList->setUsesSidebarStyle();
   panelList.onChange([&] { eventChange(); });
 
@@ -36,6 +39,7 @@ ToolsWindow::ToolsWindow() {
   panelContainer.append(streamManager, Size{~0, ~0});
   panelContainer.append(propertiesViewer, Size{~0, ~0});
   panelContainer.append(traceLogger, Size{~0, ~0});
+  panelContainer.append(frameTimingViewer, Size{~0, ~0});
   panelContainer.append(homePanel, Size{~0, ~0});
 
   manifestViewer.construct();
@@ -44,6 +48,7 @@ ToolsWindow::ToolsWindow() {
   streamManager.construct();
   propertiesViewer.construct();
   traceLogger.construct();
+  frameTimingViewer.construct();
   homePanel.construct();
 
   setDismissable();
@@ -73,6 +78,7 @@ auto ToolsWindow::eventChange() -> void {
   streamManager.setVisible(false);
   propertiesViewer.setVisible(false);
   traceLogger.setVisible(false);
+  frameTimingViewer.setVisible(false);
   homePanel.setVisible(false);
 
   bool found = false;
@@ -83,6 +89,7 @@ auto ToolsWindow::eventChange() -> void {
     if(item.text() == "Streams"   ) found = true, streamManager.setVisible();
     if(item.text() == "Properties") found = true, propertiesViewer.setVisible();
     if(item.text() == "Tracer"    ) found = true, traceLogger.setVisible();
+    if(item.text() == "Timing"    ) found = true, frameTimingViewer.setVisible();
   }
   if(!found) homePanel.setVisible();
 
@@ -85,9 +85,19 @@ struct TraceLogger : VerticalLayout {
   auto reload() -> void;
   auto unload() -> void;
   auto eventToggle(ListViewItem) -> void;
+  auto binaryStart() -> void;
+  auto binaryStop() -> void;
+  auto binaryMain(uintptr_t) -> void;
 
   file_buffer fp;
 
+  struct Binary {
+    atomic<bool> active = false;
+    nall::thread thread;
+    vector<ares::Node::Debugger::Tracer::Instruction> tracers;
+    vector<shared_pointer<file_buffer>> files;  //one per tracer, in the same order
+  } binary;
+
   Label tracerLabel{this, Size{~0, 0}, 5};
   ListView tracerList{this, Size{~0, ~0}};
   HorizontalLayout controlLayout{this, Size{~0, 0}};
@@ -96,6 +106,36 @@ struct TraceLogger : VerticalLayout {
     CheckLabel traceToTerminal{&controlLayout, Size{0, 0}};
     CheckLabel traceToFile{&controlLayout, Size{0, 0}};
     CheckLabel traceMask{&controlLayout, Size{0, 0}};
+    CheckLabel traceBinary{&controlLayout, Size{0, 0}};
+};
+
+struct FrameTimingViewer : VerticalLayout {
+  using Record = Program::FrameTiming::Record;
+  auto construct() -> void;
+  auto reload() -> void;
+  auto unload() -> void;
+  auto refresh() -> void;
+  auto liveRefresh() -> void;
+  auto eventToggle() -> void;
+  auto eventExport(bool json) -> void;
+  auto sample(u32 index) const -> u64;
+  auto setVisible(bool visible = true) -> FrameTimingViewer&;
+
+  //the most recent records are kept; older ones are discarded in blocks of History
+  static constexpr u32 History = 16384;
+  vector<Record> history;
+  u64 refreshed = 0;
+
+  Label timingLabel{this, Size{~0, 0}, 5};
+  ComboButton metricList{this, Size{~0, 0}};
+  Canvas histogramView{this, Size{~0, ~0}};
+  Label summaryLabel{this, Size{~0, 0}};
+  HorizontalLayout controlLayout{this, Size{~0, 0}};
+    Button csvButton{&controlLayout, Size{80, 0}};
+    Button jsonButton{&controlLayout, Size{80, 0}};
+    Widget spacer{&controlLayout, Size{~0, 0}};
+    CheckLabel recordOption{&controlLayout, Size{0, 0}, 2};
+    Button clearButton{&controlLayout, Size{80, 0}};
 };
 
 struct ToolsWindow : Window {
@@ -112,6 +152,7 @@ struct ToolsWindow : Window {
       StreamManager streamManager;
       PropertiesViewer propertiesViewer;
       TraceLogger traceLogger;
+      FrameTimingViewer frameTimingViewer;
       HomePanel homePanel;
 };
 
@@ -123,3 +164,4 @@ extern GraphicsViewer& graphicsViewer;
 extern StreamManager& streamManager;
 extern PropertiesViewer& propertiesViewer;
 extern TraceLogger& traceLogger;
+extern FrameTimingViewer& frameTimingViewer;
@@ -25,6 +25,10 @@ auto TraceLogger::construct() -> void {
       instruction->setMask(traceMask.checked());
     }
   });
+  traceBinary.setText("Binary").onToggle([&] {
+    if(traceBinary.checked()) binaryStart();
+    else binaryStop();
+  });
 }
 
 auto TraceLogger::reload() -> void {
@@ -38,6 +42,8 @@ auto TraceLogger::reload() -> void {
 }
 
 auto TraceLogger::unload() -> void {
+  binaryStop();
+  traceBinary.setChecked(false);
   tracerList.reset();
   if(fp) fp.close();
 }
@@ -47,3 +53,58 @@ auto TraceLogger::eventToggle(ListViewItem item) -> void {
     tracer->setEnabled(item.checked());
   }
 }
+
+//binary tracing: instruction tracers that support it record fixed-size entries into ring buffers rather than
+//formatting text, and a background thread drains those into one .trace file per tracer.
+//the files are formatted offline with tools/trace.
+auto TraceLogger::binaryStart() -> void {
+  if(!emulator || binary.active) return;
+
+  auto datetime = chrono::local::datetime().replace("-", "").replace(":", "").replace(" ", "-");
+  binary.tracers = ares::Node::enumerate<ares::Node::Debugger::Tracer::Instruction>(emulator->root);
+  binary.files.reset();
+  for(auto& tracer : binary.tracers) {
+    auto name = string{Location::notsuffix(emulator->game->location), "-", datetime, "-", tracer->component(), ".trace"};
+    shared_pointer<file_buffer> output = new file_buffer{emulator->locate(name, ".trace", settings.paths.debugging), file::mode::write};
+    output->writes("ATRC");
+    output->writel(1, 4);  //version
+    output->writel(tracer->addressBits(), 4);
+    output->writel(tracer->component().size(), 4);
+    output->writes(tracer->component());
+    binary.files.append(output);
+    tracer->setBinary(true);
+  }
+
+  binary.active = true;
+  binary.thread = nall::thread::create({&TraceLogger::binaryMain, this});
+}
+
+auto TraceLogger::binaryStop() -> void {
+  if(!binary.active) return;
+
+  //the emulator runs on this thread, so no new entries arrive while the writer drains the rest
+  binary.active = false;
+  binary.thread.join();
+  for(auto& tracer : binary.tracers) tracer->setBinary(false);
+  binary.tracers.reset();
+  binary.files.reset();
+}
+
+auto TraceLogger::binaryMain(uintptr_t) -> void {
+  while(true) {
+    bool idle = true;
+    for(u32 index : range(binary.tracers.size())) {
+      auto& output = binary.files[index];
+      while(auto record = binary.tracers[index]->read()) {
+        idle = false;
+        output->writel(record->data, 8);
+        output->writel(record->code, 4);
+        output->writel((u32)record->type, 4);
+      }
+    }
+    if(idle) {
+      if(!binary.active) break;
+      usleep(1000);
+    }
+  }
+}
@@ -133,6 +133,23 @@ int co_serializable() {
   return 1;
 }
 
+/* reports the portions of a suspended cothread's memory that must be preserved to serialize it:
+   the saved context occupies [0, *context), and the live stack occupies [*stack, size). */
+int co_live(cothread_t handle, unsigned int size, unsigned int* context, unsigned int* stack) {
+  uintptr_t base = (uintptr_t)handle;
+  uintptr_t sp = ((uintptr_t*)handle)[0];
+  #if defined(_WIN32) && !defined(LIBCO_NO_TIB)
+  unsigned int header = 192;
+  #else
+  unsigned int header = 176;
+  #endif
+  if(handle == co_active_handle) return 0;  /* a running cothread has no saved stack pointer */
+  if(sp < base + header || sp > base + size) return 0;
+  *context = header;
+  *stack = (unsigned int)(sp - base);
+  return 1;
+}
+
 #ifdef __cplusplus
 }
 #endif
@@ -179,6 +179,23 @@ int co_serializable() {
   return 1;
 }
 
+/* reports the portions of a suspended cothread's memory that must be preserved to serialize it:
+   the saved context occupies [0, *context), and the live stack occupies [*stack, size). */
+int co_live(cothread_t handle, unsigned int size, unsigned int* context, unsigned int* stack) {
+  unsigned long long base = (unsigned long long)handle;
+  unsigned long long sp = ((unsigned long long*)handle)[0];
+  #ifdef _WIN32
+  unsigned int header = 0x100;
+  #else
+  unsigned int header = 0x38;
+  #endif
+  if(handle == co_active_handle) return 0;  /* a running cothread has no saved stack pointer */
+  if(sp < base + header || sp > base + size) return 0;
+  *context = header;
+  *stack = (unsigned int)(sp - base);
+  return 1;
+}
+
 #ifdef __cplusplus
 }
 #endif
@@ -79,6 +79,19 @@ int co_serializable() {
   return 1;
 }
 
+/* reports the portions of a suspended cothread's memory that must be preserved to serialize it:
+   the saved context occupies [0, *context), and the live stack occupies [*stack, size). */
+int co_live(cothread_t handle, unsigned int size, unsigned int* context, unsigned int* stack) {
+  unsigned long base = (unsigned long)handle;
+  unsigned long sp = ((unsigned long*)handle)[8];
+  unsigned int header = 40;
+  if(handle == co_active_handle) return 0;  /* a running cothread has no saved stack pointer */
+  if(sp < base + header || sp > base + size) return 0;
+  *context = header;
+  *stack = (unsigned int)(sp - base);
+  return 1;
+}
+
 #ifdef __cplusplus
 }
 #endif
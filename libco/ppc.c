@@ -429,3 +429,7 @@ void co_switch(cothread_t t) {
 int co_serializable() {
   return 0;
 }
+
+int co_live(cothread_t handle, unsigned int size, unsigned int* context, unsigned int* stack) {
+  return 0;
+}
@@ -275,6 +275,20 @@ int co_serializable() {
   return 1;
 }
 
+/* reports the portions of a suspended cothread's memory that must be preserved to serialize it:
+   the saved context occupies [0, *context), and the live stack occupies [*stack, size).
+   the 288-byte protected zone below the stack pointer is conservatively treated as live. */
+int co_live(cothread_t handle, unsigned int size, unsigned int* context, unsigned int* stack) {
+  uintptr_t base = (uintptr_t)handle;
+  uintptr_t sp = ((struct ppc64_context*)handle)->gprs[1] - 288;
+  unsigned int header = sizeof(struct ppc64_context);
+  if(handle == (cothread_t)co_active_handle) return 0;  /* a running cothread has no saved stack pointer */
+  if(sp < base + header || sp > base + size) return 0;
+  *context = header;
+  *stack = (unsigned int)(sp - base);
+  return 1;
+}
+
 #ifdef __cplusplus
 }
 #endif
@@ -1,20 +1,458 @@
 #pragma once
 
-//a bad implementation of inflate from zlib/minizip
-//todo: replace with Talarubi's version
+//inflate (RFC 1951) decoder.
+//Huffman codes are resolved with a single table lookup in the common case, and pairs of short
+//literal codes are resolved together. inflate() decodes a whole stream into a caller buffer,
+//while the Inflate class can also stream its output out in pieces of any size.
+//puff, the reference decoder from zlib/contrib, is kept below for comparison.
 
 #include <setjmp.h>
 
 namespace nall::Decode {
 
-namespace puff {
-  inline auto puff(u8* dest, u32* destlen, u8* source, u32* sourcelen) -> s32;
-}
+struct Inflate {
+  static constexpr u32 Window = 32768;  //maximum match distance
+
+  Inflate() = default;
+  Inflate(const Inflate&) = delete;
+  auto operator=(const Inflate&) -> Inflate& = delete;
+  ~Inflate() { delete[] window; }
+
+  explicit operator bool() const { return state != State::Error; }
+  auto finished() const -> bool { return state == State::Done; }
+
+  //decodes the entire stream into target: fails if it is corrupt, truncated, or does not fit.
+  auto decode(u8* target, u64 targetSize, const u8* source, u64 sourceSize) -> bool {
+    reset(source, sourceSize);
+    base = output = position = target;
+    end = target + targetSize;
+    run();
+    return state == State::Done;
+  }
+
+  //prepares to stream the decoded source out through read().
+  auto open(const u8* source, u64 sourceSize) -> void {
+    reset(source, sourceSize);
+    if(!window) window = new u8[Window * 2];
+    base = output = position = window;
+    end = window + Window * 2;
+  }
+
+  //returns the number of bytes read: less than length once the stream has ended, or on error.
+  auto read(u8* target, u64 length) -> u64 {
+    u64 total = 0;
+    while(length) {
+      if(position == output) {
+        if(state == State::Done || state == State::Error) break;
+        if(output == end) {
+          //keep the last window of output as the history for future matches
+          memmove(base, end - Window, Window);
+          output = position = base + Window;
+        }
+        run();
+        continue;
+      }
+      u64 size = output - position;
+      if(size > length) size = length;
+      memcpy(target, position, size);
+      position += size;
+      target += size;
+      length -= size;
+      total += size;
+    }
+    return total;
+  }
+
+protected:
+  static constexpr u32 LitlenBits   = 11;  //primary lookup size of the literal/length table
+  static constexpr u32 DistanceBits =  8;  //primary lookup size of the distance table
+  static constexpr u32 LengthsBits  =  7;  //longest code length code
+
+  enum class State : u32 { Header, Stored, Codes, Copy, Done, Error };
+  enum class Code : u32 { Litlen, Distance, Lengths };
+
+  //table entries hold the code length in bits 0-4, the kind in bits 5-7, the extra bit count in
+  //bits 8-11, and the value in bits 16-31. a pair holds the first code length in bits 8-11, and
+  //its two literals in bits 16-31. a subtable holds its index width in bits 8-11.
+  enum : u32 { Literal, Pair, Base, End, Subtable, Invalid };
+
+  static auto kind(u32 entry) -> u32 { return entry >> 5 & 7; }
+
+  static auto symbol(Code code, u32 symbol) -> u32 {
+    static const u16 lengthBase[29] = {
+      3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+      35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258,
+    };
+    static const u8 lengthExtra[29] = {
+      0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+      3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0,
+    };
+    static const u16 distanceBase[30] = {
+      1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+      257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577,
+    };
+    static const u8 distanceExtra[30] = {
+      0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+      7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13,
+    };
+
+    if(code == Code::Lengths) return Literal << 5 | symbol << 16;
+    if(code == Code::Distance) {
+      if(symbol >= 30) return Invalid << 5;
+      return Base << 5 | distanceExtra[symbol] << 8 | distanceBase[symbol] << 16;
+    }
+    if(symbol < 256) return Literal << 5 | symbol << 16;
+    if(symbol == 256) return End << 5;
+    if((symbol -= 257) >= 29) return Invalid << 5;
+    return Base << 5 | lengthExtra[symbol] << 8 | lengthBase[symbol] << 16;
+  }
+
+  //builds a decoding table for a canonical Huffman code: fails if the code is oversubscribed,
+  //or incomplete other than the single code deflate allows for literal/lengths and distances.
+  static auto build(u32* table, u32 bits, const u8* lengths, u32 symbols, Code code) -> bool {
+    u32 counts[16] = {};
+    for(u32 n : range(symbols)) counts[lengths[n]]++;
+    for(u32 n : range(1 << bits)) table[n] = Invalid << 5;
+    if(counts[0] == symbols) return true;
+
+    s32 left = 1;
+    u32 maximum = 0;
+    for(u32 length : range(1, 16)) {
+      left = (left << 1) - counts[length];
+      if(left < 0) return false;
+      if(counts[length]) maximum = length;
+    }
+    if(left > 0 && (code == Code::Lengths || symbols - counts[0] != 1)) return false;
+
+    u16 offsets[16] = {};
+    u16 sorted[288];
+    for(u32 length : range(1, 15)) offsets[length + 1] = offsets[length] + counts[length];
+    for(u32 n : range(symbols)) {
+      if(lengths[n]) sorted[offsets[lengths[n]]++] = n;
+    }
+
+    u32 subtableBits = maximum > bits ? maximum - bits : 0;
+    u32 next = 1 << bits;
+    u32 canonical = 0, index = 0;
+    for(u32 length = 1; length <= maximum; length++, canonical <<= 1) {
+      for(u32 count = counts[length]; count; count--) {
+        u32 data = symbol(code, sorted[index++]);
+        u32 reversed = 0;
+        for(u32 bit : range(length)) reversed |= (canonical >> bit & 1) << (length - 1 - bit);
+        canonical++;
+
+        if(length <= bits) {
+          for(u32 slot = reversed; slot < 1u << bits; slot += 1 << length) table[slot] = data | length;
+          continue;
+        }
+
+        //codes longer than the primary lookup continue into a subtable for their prefix
+        u32& prefix = table[reversed & ((1 << bits) - 1)];
+        if(kind(prefix) != Subtable) {
+          prefix = bits | Subtable << 5 | subtableBits << 8 | next << 16;
+          for(u32 slot : range(1 << subtableBits)) table[next + slot] = Invalid << 5;
+          next += 1 << subtableBits;
+        }
+        u32* subtable = table + (prefix >> 16);
+        u32 remaining = length - bits;
+        for(u32 slot = reversed >> bits; slot < 1u << subtableBits; slot += 1 << remaining) subtable[slot] = data | remaining;
+      }
+    }
+
+    if(code == Code::Litlen) {
+      //where two literal codes fit in the primary lookup together, decode both at once.
+      //the second code follows the first, so its entry is found by shifting the first out;
+      //walking downward reads each such entry before it has been paired itself.
+      for(u32 n = 1 << bits; n--;) {
+        u32 first = table[n];
+        if(kind(first) != Literal) continue;
+        u32 length = first & 31;
+        u32 second = table[n >> length];
+        if(kind(second) != Literal || length + (second & 31) > bits) continue;
+        table[n] = (length + (second & 31)) | Pair << 5 | length << 8 | (first >> 16 | second >> 16 << 8) << 16;
+      }
+    }
+
+    return true;
+  }
+
+  auto reset(const u8* source, u64 sourceSize) -> void {
+    input = source;
+    inputEnd = source + sourceSize;
+    buffer = 0;
+    count = 0;
+    state = State::Header;
+    final = false;
+    storedLength = 0;
+    copyLength = 0;
+    copyDistance = 0;
+  }
+
+  auto fail() -> void {
+    state = State::Error;
+  }
+
+  //tops the bit buffer up to at least 56 bits, while enough input remains.
+  //only whole bytes are counted as consumed: the bits above count repeat the unread input.
+  alwaysinline auto refill() -> void {
+    #if defined(ENDIAN_LITTLE)
+    if(inputEnd - input >= 8) {
+      u64 word;
+      memcpy(&word, input, 8);
+      buffer |= word << count;
+      input += 7 - (count >> 3 & 7);
+      count |= 56;
+      return;
+    }
+    #endif
+    while(count <= 56 && input < inputEnd) {
+      buffer |= (u64)*input++ << count;
+      count += 8;
+    }
+  }
+
+  alwaysinline auto consume(u32 bits) -> bool {
+    if(bits > count) return fail(), false;
+    buffer >>= bits;
+    count -= bits;
+    return true;
+  }
+
+  alwaysinline auto take(u32 bits) -> u32 {
+    u32 data = buffer & ((1ull << bits) - 1);
+    return consume(bits) ? data : 0;
+  }
+
+  alwaysinline auto lookup(const u32* table, u32 bits) -> u32 {
+    u32 entry = table[buffer & ((1 << bits) - 1)];
+    if(kind(entry) == Subtable) {
+      if(!consume(entry & 31)) return Invalid << 5;
+      entry = table[(entry >> 16) + (buffer & ((1 << (entry >> 8 & 15)) - 1))];
+    }
+    return entry;
+  }
+
+  auto run() -> void {
+    while(true) {
+      if(state == State::Header) { header(); continue; }
+      if(state == State::Done || state == State::Error) return;
+      //the end of block code may still be decoded once the output is full
+      if(state == State::Codes) { codes(); if(state == State::Codes) return; continue; }
+      if(output == end) return;
+      if(state == State::Stored) stored();
+      if(state == State::Copy) copy();
+    }
+  }
+
+  auto header() -> void {
+    refill();
+    if(count < 3) return fail();
+    final = take(1);
+    u32 type = take(2);
+    if(type == 0) return storedHeader();
+    if(type == 1) return fixed();
+    if(type == 2) return dynamic();
+    return fail();
+  }
+
+  auto storedHeader() -> void {
+    //discard up to the byte boundary, then hand the bytes still buffered back to the input
+    consume(count & 7);
+    input -= count >> 3;
+    buffer = 0;
+    count = 0;
+
+    if(inputEnd - input < 4) return fail();
+    u32 length = input[0] | input[1] << 8;
+    u32 complement = input[2] | input[3] << 8;
+    input += 4;
+    if(length != (~complement & 0xffff)) return fail();
+
+    storedLength = length;
+    state = length ? State::Stored : final ? State::Done : State::Header;
+  }
+
+  auto stored() -> void {
+    u64 length = end - output;
+    if(length > storedLength) length = storedLength;
+    if((u64)(inputEnd - input) < length) return fail();
+    memcpy(output, input, length);
+    output += length;
+    input += length;
+    storedLength -= length;
+    if(!storedLength) state = final ? State::Done : State::Header;
+  }
+
+  //the fixed code is the same for every stream, so its tables are only built once
+  struct Fixed {
+    Fixed() {
+      u8 lengths[288];
+      for(u32 n : range(288)) lengths[n] = n < 144 ? 8 : n < 256 ? 9 : n < 280 ? 7 : 8;
+      build(litlen, LitlenBits, lengths, 288, Code::Litlen);
+      for(u32 n : range(32)) lengths[n] = 5;
+      build(distance, DistanceBits, lengths, 32, Code::Distance);
+    }
+
+    u32 litlen[1 << LitlenBits];
+    u32 distance[1 << DistanceBits];
+  };
+
+  auto fixed() -> void {
+    static const Fixed tables;
+    litlenLookup = tables.litlen;
+    distanceLookup = tables.distance;
+    state = State::Codes;
+  }
+
+  auto dynamic() -> void {
+    static const u8 order[19] = {16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15};
+    u8 lengths[286 + 30];
+
+    refill();
+    if(count < 14) return fail();
+    u32 litlens = take(5) + 257;
+    u32 distances = take(5) + 1;
+    u32 codes = take(4) + 4;
+    if(litlens > 286 || distances > 30) return fail();
+
+    for(u32 n : range(19)) {
+      refill();
+      lengths[order[n]] = n < codes ? take(3) : 0;
+    }
+    if(state == State::Error) return;
+    if(!build(lengthsTable, LengthsBits, lengths, 19, Code::Lengths)) return fail();
+
+    for(u32 index = 0; index < litlens + distances;) {
+      refill();
+      u32 entry = lengthsTable[buffer & ((1 << LengthsBits) - 1)];
+      if(kind(entry) != Literal || !consume(entry & 31)) return fail();
+      u32 symbol = entry >> 16;
+      if(symbol < 16) {
+        lengths[index++] = symbol;
+        continue;
+      }
+      u32 length = 0, repeat = 0;
+      if(symbol == 16) {
+        if(index == 0) return fail();
+        length = lengths[index - 1];
+        repeat = 3 + take(2);
+      } else if(symbol == 17) {
+        repeat = 3 + take(3);
+      } else {
+        repeat = 11 + take(7);
+      }
+      if(state == State::Error) return;
+      if(index + repeat > litlens + distances) return fail();
+      while(repeat--) lengths[index++] = length;
+    }
+
+    if(lengths[256] == 0) return fail();
+    if(!build(litlenTable, LitlenBits, lengths, litlens, Code::Litlen)) return fail();
+    if(!build(distanceTable, DistanceBits, lengths + litlens, distances, Code::Distance)) return fail();
+    litlenLookup = litlenTable;
+    distanceLookup = distanceTable;
+    state = State::Codes;
+  }
+
+  //returns in the Codes state only once the output is full.
+  auto codes() -> void {
+    while(true) {
+      //one refill covers the longest length code, distance code and their extra bits: 48 bits
+      refill();
+      u32 entry = lookup(litlenLookup, LitlenBits);
+      if(kind(entry) == End) {
+        if(!consume(entry & 31)) return;
+        state = final ? State::Done : State::Header;
+        return;
+      }
+      if(output == end) return;
+      if(kind(entry) == Pair) {
+        if(end - output >= 2) {
+          if(!consume(entry & 31)) return;
+          output[0] = entry >> 16;
+          output[1] = entry >> 24;
+          output += 2;
+        } else {
+          if(!consume(entry >> 8 & 15)) return;
+          output[0] = entry >> 16;
+          output += 1;
+        }
+        continue;
+      }
+      if(!consume(entry & 31)) return;
+      if(kind(entry) == Literal) {
+        *output++ = entry >> 16;
+        continue;
+      }
+      if(kind(entry) != Base) return fail();
+      u32 length = (entry >> 16) + take(entry >> 8 & 15);
+
+      entry = lookup(distanceLookup, DistanceBits);
+      if(kind(entry) != Base || !consume(entry & 31)) return fail();
+      u32 distance = (entry >> 16) + take(entry >> 8 & 15);
+      if(state == State::Error) return;
+      if(distance > output - base) return fail();
+
+      copyLength = length;
+      copyDistance = distance;
+      state = State::Copy;
+      copy();
+      if(state != State::Codes) return;
+    }
+  }
+
+  auto copy() -> void {
+    u64 length = end - output;
+    if(length > copyLength) length = copyLength;
+    const u8* source = output - copyDistance;
+    u8* target = output;
+    output += length;
+    copyLength -= length;
+    if(copyDistance >= 8 && (u64)(end - target) >= length + 7) {
+      //eight bytes at a time may overrun the match, but never reads bytes it has yet to write
+      do {
+        memcpy(target, source, 8);
+        target += 8;
+        source += 8;
+      } while(target < output);
+    } else if(copyDistance == 1) {
+      memset(target, *source, length);
+    } else {
+      while(target < output) *target++ = *source++;
+    }
+    if(!copyLength) state = State::Codes;
+  }
+
+  const u8* input = nullptr;
+  const u8* inputEnd = nullptr;
+  u64 buffer = 0;
+  u32 count = 0;
+
+  u8* base = nullptr;      //start of the match history
+  u8* output = nullptr;    //next byte to be decoded
+  u8* end = nullptr;       //end of the output space
+  u8* position = nullptr;  //next byte to be read
+  u8* window = nullptr;
+
+  State state = State::Header;
+  bool final = false;
+  u32 storedLength = 0;
+  u32 copyLength = 0;
+  u32 copyDistance = 0;
+
+  const u32* litlenLookup = nullptr;    //tables of the current block
+  const u32* distanceLookup = nullptr;
+  u32 litlenTable[(1 << LitlenBits) + 288 * (1 << (15 - LitlenBits))];
+  u32 distanceTable[(1 << DistanceBits) + 32 * (1 << (15 - DistanceBits))];
+  u32 lengthsTable[1 << LengthsBits];
+};
 
-inline auto inflate(u8* target, u32 targetLength, const u8* source, u32 sourceLength) -> bool {
-  u32 tl = targetLength, sl = sourceLength;
-  s32 result = puff::puff((u8*)target, &tl, (u8*)source, &sl);
-  return result == 0;
+inline auto inflate(u8* target, u64 targetLength, const u8* source, u64 sourceLength) -> bool {
+  //the decoding tables are too large to place on a cothread stack
+  auto decoder = new Inflate;
+  bool result = decoder->decode(target, targetLength, source, sourceLength);
+  delete decoder;
+  return result;
 }
 
 namespace puff {
@@ -11,8 +11,8 @@ struct ZIP {
   struct File {
     string name;
     const u8* data;
-    u32 size;
-    u32 csize;
+    u64 size;
+    u64 csize;
     u32 cmode;  //0 = uncompressed, 8 = deflate
     u32 crc32;
     time_t timestamp;
@@ -32,7 +32,7 @@ struct ZIP {
     return true;
   }
 
-  auto open(const u8* data, u32 size) -> bool {
+  auto open(const u8* data, u64 size) -> bool {
     if(size < 22) return false;
 
     filedata = data;
@@ -49,9 +49,21 @@ struct ZIP {
       }
       footer--;
     }
-    const u8* directory = data + read(footer + 16, 4);
+    u64 directoryOffset = read(footer + 16, 4);
+
+    //ZIP64 archives place a locator for the ZIP64 end of central directory record before the footer
+    const u8* locator = footer - 20;
+    if(read(locator, 4) == 0x07064b50) {
+      u64 recordOffset = read(locator + 8, 8);
+      if(recordOffset + 56 > size) return false;
+      const u8* record = data + recordOffset;
+      if(read(record, 4) != 0x06064b50) return false;
+      directoryOffset = read(record + 48, 8);
+    }
+    if(directoryOffset >= size) return false;
+    const u8* directory = data + directoryOffset;
 
-    while(true) {
+    while(directory + 46 <= data + size) {
       u32 signature = read(directory + 0, 4);
       if(signature != 0x02014b50) break;
 
@@ -83,10 +95,27 @@ struct ZIP {
       file.name = filename;
       delete[] filename;
 
-      u32 offset = read(directory + 42, 4);
+      u64 offset = read(directory + 42, 4);
+
+      //sizes and offsets too large for their fields are moved into the ZIP64 extra field
+      const u8* extra = directory + 46 + namelength;
+      const u8* extraEnd = extra + extralength;
+      while(extra + 4 <= extraEnd) {
+        u32 id = read(extra + 0, 2);
+        u32 length = read(extra + 2, 2);
+        const u8* field = extra + 4;
+        extra = field + length;
+        if(id != 0x0001 || extra > extraEnd) continue;
+        if(file.size  == 0xffffffff && field + 8 <= extra) file.size  = read(field, 8), field += 8;
+        if(file.csize == 0xffffffff && field + 8 <= extra) file.csize = read(field, 8), field += 8;
+        if(offset     == 0xffffffff && field + 8 <= extra) offset     = read(field, 8), field += 8;
+      }
+
+      if(offset + 30 > size) return false;
       u32 offsetNL = read(data + offset + 26, 2);
       u32 offsetEL = read(data + offset + 28, 2);
       file.data = data + offset + 30 + offsetNL + offsetEL;
+      if(offset + 30 + offsetNL + offsetEL + file.csize > size) return false;
 
       directory += 46 + namelength + extralength + commentlength;
 
@@ -98,20 +127,33 @@ struct ZIP {
 
   auto extract(File& file) -> vector<u8> {
     vector<u8> buffer;
+    buffer.resize(file.size);
+    if(extract(file, buffer.data(), buffer.size()) == false) buffer.reset();
+    return buffer;
+  }
+
+  //decodes the file into a caller buffer, which must hold at least file.size bytes.
+  auto extract(File& file, u8* target, u64 size) -> bool {
+    if(size < file.size) return false;
 
     if(file.cmode == 0) {
-      buffer.resize(file.size);
-      memcpy(buffer.data(), file.data, file.size);
+      if(file.csize != file.size) return false;
+      memcpy(target, file.data, file.size);
+      return true;
     }
 
     if(file.cmode == 8) {
-      buffer.resize(file.size);
-      if(inflate(buffer.data(), buffer.size(), file.data, file.csize) == false) {
-        buffer.reset();
-      }
+      return inflate(target, file.size, file.data, file.csize);
     }
 
-    return buffer;
+    return false;
+  }
+
+  //prepares to decode the file in pieces through Inflate::read(), without holding all of it in memory.
+  auto stream(File& file, Inflate& inflater) -> bool {
+    if(file.cmode != 8) return false;
+    inflater.open(file.data, file.csize);
+    return true;
   }
 
   auto close() -> void {
@@ -121,11 +163,11 @@ struct ZIP {
 protected:
   file_map fm;
   const u8* filedata;
-  u32 filesize;
+  u64 filesize;
 
-  auto read(const u8* data, u32 size) -> u32 {
-    u32 result = 0, shift = 0;
-    while(size--) { result |= *data++ << shift; shift += 8; }
+  auto read(const u8* data, u32 size) -> u64 {
+    u64 result = 0, shift = 0;
+    while(size--) { result |= (u64)*data++ << shift; shift += 8; }
     return result;
   }
 
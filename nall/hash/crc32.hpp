@@ -2,6 +2,10 @@
 
 #include <nall/hash/hash.hpp>
 
+#if defined(ARCHITECTURE_ARM64) && defined(__ARM_FEATURE_CRC32)
+  #include <arm_acle.h>
+#endif
+
 namespace nall::Hash {
 
 struct CRC32 : Hash {
@@ -17,7 +21,11 @@ struct CRC32 : Hash {
   }
 
   auto input(u8 value) -> void override {
-    checksum = (checksum >> 8) ^ table(checksum ^ value);
+    checksum = (checksum >> 8) ^ tables().table[0][(u8)checksum ^ value];
+  }
+
+  auto input(const void* data, u64 size) -> void override {
+    checksum = update(checksum, (const u8*)data, size);
   }
 
   auto output() const -> vector<u8> override {
@@ -30,23 +38,132 @@ struct CRC32 : Hash {
     return ~checksum;
   }
 
-private:
-  static auto table(u8 index) -> u32 {
-    static u32 table[256] = {};
-    static bool initialized = false;
+  //each implementation continues the checksum register crc over [data, data + size).
+  static auto update(u32 crc, const u8* data, u64 size) -> u32 {
+    #if defined(ARCHITECTURE_AMD64)
+    if(size >= 64 && Processor::features().clmul) return fold(crc, data, size);
+    #elif defined(ARCHITECTURE_ARM64) && defined(__ARM_FEATURE_CRC32)
+    return instructions(crc, data, size);
+    #endif
+    return slice(crc, data, size);
+  }
+
+  //slicing-by-8: eight table lookups retire eight bytes at once.
+  static auto slice(u32 crc, const u8* data, u64 size) -> u32 {
+    auto& table = tables().table;
+    while(size >= 8) {
+      u32 lo = crc ^ memory::readl<4, u32>(data + 0);
+      u32 hi = memory::readl<4, u32>(data + 4);
+      crc = table[7][lo >>  0 & 0xff] ^ table[6][lo >>  8 & 0xff]
+          ^ table[5][lo >> 16 & 0xff] ^ table[4][lo >> 24 & 0xff]
+          ^ table[3][hi >>  0 & 0xff] ^ table[2][hi >>  8 & 0xff]
+          ^ table[1][hi >> 16 & 0xff] ^ table[0][hi >> 24 & 0xff];
+      data += 8;
+      size -= 8;
+    }
+    while(size--) crc = (crc >> 8) ^ table[0][(u8)crc ^ *data++];
+    return crc;
+  }
 
-    if(!initialized) {
-      initialized = true;
+  #if defined(ARCHITECTURE_AMD64)
+  nallHashTarget("pclmul,sse4.1")
+  static auto load(const u8* data) -> __m128i {
+    return _mm_loadu_si128((const __m128i*)data);
+  }
+
+  //multiplies both halves of x by their folding constants in k, and adds in the next block y
+  nallHashTarget("pclmul,sse4.1")
+  static auto fold16(__m128i x, __m128i k, __m128i y) -> __m128i {
+    return _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x, k, 0x00), _mm_clmulepi64_si128(x, k, 0x11)), y);
+  }
+
+  //folds 64 bytes at a time with carry-less multiplication, as described in Intel's
+  //"Fast CRC Computation for Generic Polynomials Using PCLMULQDQ Instruction".
+  //requires size >= 64; the tail that does not fill a 16-byte block is finished by slice().
+  nallHashTarget("pclmul,sse4.1")
+  static auto fold(u32 crc, const u8* data, u64 size) -> u32 {
+    const __m128i k1k2 = _mm_set_epi64x(0x01c6e41596, 0x0154442bd4);
+    const __m128i k3k4 = _mm_set_epi64x(0x00ccaa009e, 0x01751997d0);
+    const __m128i k5k0 = _mm_set_epi64x(0x0000000000, 0x0163cd6124);
+    const __m128i poly = _mm_set_epi64x(0x01f7011641, 0x01db710641);
+    const __m128i mask = _mm_setr_epi32(~0, 0, ~0, 0);
+
+    __m128i x1 = _mm_xor_si128(load(data + 0x00), _mm_cvtsi32_si128(crc));
+    __m128i x2 = load(data + 0x10);
+    __m128i x3 = load(data + 0x20);
+    __m128i x4 = load(data + 0x30);
+    data += 64;
+    size -= 64;
+
+    while(size >= 64) {
+      x1 = fold16(x1, k1k2, load(data + 0x00));
+      x2 = fold16(x2, k1k2, load(data + 0x10));
+      x3 = fold16(x3, k1k2, load(data + 0x20));
+      x4 = fold16(x4, k1k2, load(data + 0x30));
+      data += 64;
+      size -= 64;
+    }
+
+    x1 = fold16(x1, k3k4, x2);
+    x1 = fold16(x1, k3k4, x3);
+    x1 = fold16(x1, k3k4, x4);
+    while(size >= 16) {
+      x1 = fold16(x1, k3k4, load(data));
+      data += 16;
+      size -= 16;
+    }
+
+    //reduce 128 bits to 64 bits, then to the 32-bit remainder with a Barrett reduction
+    x2 = _mm_clmulepi64_si128(x1, k3k4, 0x10);
+    x1 = _mm_xor_si128(_mm_srli_si128(x1, 8), x2);
+    x2 = _mm_srli_si128(x1, 4);
+    x1 = _mm_xor_si128(_mm_clmulepi64_si128(_mm_and_si128(x1, mask), k5k0, 0x00), x2);
+    x2 = _mm_clmulepi64_si128(_mm_and_si128(x1, mask), poly, 0x10);
+    x2 = _mm_clmulepi64_si128(_mm_and_si128(x2, mask), poly, 0x00);
+    crc = _mm_extract_epi32(_mm_xor_si128(x1, x2), 1);
+
+    return slice(crc, data, size);
+  }
+  #endif
+
+  #if defined(ARCHITECTURE_ARM64) && defined(__ARM_FEATURE_CRC32)
+  //the armv8 CRC32 instructions use this polynomial directly.
+  static auto instructions(u32 crc, const u8* data, u64 size) -> u32 {
+    while(size >= 8) {
+      crc = __crc32d(crc, memory::readl<8, u64>(data));
+      data += 8;
+      size -= 8;
+    }
+    while(size--) crc = __crc32b(crc, *data++);
+    return crc;
+  }
+  #endif
+
+private:
+  struct Tables {
+    Tables() {
       for(auto index : range(256)) {
         u32 crc = index;
         for(auto bit : range(8)) {
           crc = (crc >> 1) ^ (crc & 1 ? 0xedb8'8320 : 0);
         }
-        table[index] = crc;
+        table[0][index] = crc;
+      }
+      for(auto index : range(256)) {
+        for(auto slice : range(1, 8)) {
+          u32 crc = table[slice - 1][index];
+          table[slice][index] = (crc >> 8) ^ table[0][(u8)crc];
+        }
       }
     }
 
-    return table[index];
+    u32 table[8][256];
+  };
+
+  //built on first use, safely even when several threads hash at once
+  static auto tables() -> const Tables& {
+    static const Tables tables;
+    return tables;
   }
 
   u32 checksum = 0;
@@ -4,6 +4,12 @@
 #include <nall/range.hpp>
 #include <nall/string.hpp>
 
+#if defined(ARCHITECTURE_AMD64) && defined(COMPILER_MICROSOFT)
+  #include <intrin.h>
+#elif defined(ARCHITECTURE_AMD64)
+  #include <cpuid.h>
+#endif
+
 //cannot use constructor inheritance due to needing to call virtual reset();
 //instead, define a macro to reduce boilerplate code in every Hash subclass
 #define nallHash(Name) \
@@ -15,26 +21,72 @@
 
 namespace nall::Hash {
 
+//instruction set extensions used by the accelerated hash paths, detected once at runtime.
+//on arm64 they are only used when the compiler targets them, which all Apple silicon does.
+struct Processor {
+  static auto features() -> const Processor& {
+    static const Processor processor;
+    return processor;
+  }
+
+  bool clmul = false;   //carry-less multiplication: CRC32 folding
+  bool crc32 = false;   //arm64 CRC32 instructions
+  bool sha256 = false;  //SHA-256 rounds and message schedule
+
+private:
+  Processor() {
+    #if defined(ARCHITECTURE_AMD64)
+    u32 leaf1[4] = {}, leaf7[4] = {};
+    #if defined(COMPILER_MICROSOFT)
+    __cpuid((int*)leaf1, 1);
+    __cpuidex((int*)leaf7, 7, 0);
+    #else
+    __get_cpuid(1, &leaf1[0], &leaf1[1], &leaf1[2], &leaf1[3]);
+    __get_cpuid_count(7, 0, &leaf7[0], &leaf7[1], &leaf7[2], &leaf7[3]);
+    #endif
+    bool ssse3  = leaf1[2] >>  9 & 1;
+    bool sse4_1 = leaf1[2] >> 19 & 1;
+    clmul  = leaf1[2] >> 1 & 1 && sse4_1;
+    sha256 = leaf7[1] >> 29 & 1 && ssse3 && sse4_1;
+    #elif defined(ARCHITECTURE_ARM64)
+    #if defined(__ARM_FEATURE_CRC32)
+    crc32 = true;
+    #endif
+    #if defined(__ARM_FEATURE_SHA2) || defined(__ARM_FEATURE_CRYPTO)
+    sha256 = true;
+    #endif
+    #endif
+  }
+};
+
+//functions using instruction set extensions that the compiler may not otherwise target
+#if defined(COMPILER_MICROSOFT)
+  #define nallHashTarget(features)
+#else
+  #define nallHashTarget(features) __attribute__((target(features)))
+#endif
+
 struct Hash {
   virtual auto reset() -> void = 0;
   virtual auto input(u8 data) -> void = 0;
   virtual auto output() const -> vector<u8> = 0;
 
-  auto input(array_view<u8> data) -> void {
-    for(auto byte : data) input(byte);
-  }
-
-  auto input(const void* data, u64 size) -> void {
+  //hashes with faster paths for longer inputs override this
+  virtual auto input(const void* data, u64 size) -> void {
     auto p = (const u8*)data;
     while(size--) input(*p++);
   }
 
+  auto input(array_view<u8> data) -> void {
+    input(data.data(), data.size());
+  }
+
   auto input(const vector<u8>& data) -> void {
-    for(auto byte : data) input(byte);
+    input(data.data(), data.size());
   }
 
   auto input(const string& data) -> void {
-    for(auto byte : data) input(byte);
+    input(data.data(), data.size());
   }
 
   auto digest() const -> string {
@@ -2,6 +2,11 @@
 
 #include <nall/hash/hash.hpp>
 
+#if defined(ARCHITECTURE_ARM64) && (defined(__ARM_FEATURE_SHA2) || defined(__ARM_FEATURE_CRYPTO))
+  #include <arm_neon.h>
+  #define NALL_HASH_SHA256_ARM64
+#endif
+
 namespace nall::Hash {
 
 struct SHA256 : Hash {
@@ -24,6 +29,18 @@ struct SHA256 : Hash {
     length++;
   }
 
+  auto input(const void* data, u64 size) -> void override {
+    auto p = (const u8*)data;
+    length += size;
+    while(queued && size) byte(*p++), size--;
+    if(u64 blocks = size / 64) {
+      compress(p, blocks);
+      p += blocks * 64;
+      size -= blocks * 64;
+    }
+    while(size--) byte(*p++);
+  }
+
   auto output() const -> vector<u8> override {
     SHA256 self(*this);
     self.finish();
@@ -69,6 +86,88 @@ private:
     for(auto n : range(8)) h[n] += t[n];
   }
 
+  //compresses whole blocks straight from the input, with the SHA extensions when available.
+  auto compress(const u8* data, u64 blocks) -> void {
+    #if defined(ARCHITECTURE_AMD64)
+    if(Processor::features().sha256) return extensions(h, data, blocks);
+    #elif defined(NALL_HASH_SHA256_ARM64)
+    return extensions(h, data, blocks);
+    #endif
+    while(blocks--) {
+      for(auto n : range(16)) queue[n] = memory::readm<4, u32>(data + n * 4);
+      block();
+      data += 64;
+    }
+  }
+
+  #if defined(ARCHITECTURE_AMD64)
+  //the message is processed four words at a time: each group of four words is added to its
+  //round constants for two sha256rnds2 steps, and the schedule derives the group four ahead.
+  nallHashTarget("sha,sse4.1,ssse3")
+  static auto extensions(u32* h, const u8* data, u64 blocks) -> void {
+    const __m128i swap = _mm_set_epi64x(0x0c0d0e0f08090a0b, 0x0405060700010203);
+    const u32* k = cubes();
+
+    //the state is held as the register pairs ABEF and CDGH
+    __m128i t = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i*)&h[0]), 0xb1);
+    __m128i state1 = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i*)&h[4]), 0x1b);
+    __m128i state0 = _mm_alignr_epi8(t, state1, 8);
+    state1 = _mm_blend_epi16(state1, t, 0xf0);
+
+    while(blocks--) {
+      __m128i save0 = state0, save1 = state1;
+      __m128i message[4];
+      for(u32 n : range(4)) message[n] = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(data + n * 16)), swap);
+      for(u32 n : range(16)) {
+        __m128i rounds = _mm_add_epi32(message[n & 3], _mm_loadu_si128((const __m128i*)&k[n * 4]));
+        state1 = _mm_sha256rnds2_epu32(state1, state0, rounds);
+        state0 = _mm_sha256rnds2_epu32(state0, state1, _mm_shuffle_epi32(rounds, 0x0e));
+        if(n < 12) {
+          __m128i next = _mm_sha256msg1_epu32(message[n & 3], message[(n + 1) & 3]);
+          next = _mm_add_epi32(next, _mm_alignr_epi8(message[(n + 3) & 3], message[(n + 2) & 3], 4));
+          message[n & 3] = _mm_sha256msg2_epu32(next, message[(n + 3) & 3]);
+        }
+      }
+      state0 = _mm_add_epi32(state0, save0);
+      state1 = _mm_add_epi32(state1, save1);
+      data += 64;
+    }
+
+    t = _mm_shuffle_epi32(state0, 0x1b);
+    state1 = _mm_shuffle_epi32(state1, 0xb1);
+    _mm_storeu_si128((__m128i*)&h[0], _mm_blend_epi16(t, state1, 0xf0));
+    _mm_storeu_si128((__m128i*)&h[4], _mm_alignr_epi8(state1, t, 8));
+  }
+  #elif defined(NALL_HASH_SHA256_ARM64)
+  static auto extensions(u32* h, const u8* data, u64 blocks) -> void {
+    const u32* k = cubes();
+    uint32x4_t state0 = vld1q_u32(&h[0]);
+    uint32x4_t state1 = vld1q_u32(&h[4]);
+
+    while(blocks--) {
+      uint32x4_t save0 = state0, save1 = state1;
+      uint32x4_t message[4];
+      for(u32 n : range(4)) message[n] = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(data + n * 16)));
+      for(u32 n : range(16)) {
+        uint32x4_t rounds = vaddq_u32(message[n & 3], vld1q_u32(&k[n * 4]));
+        if(n < 12) {
+          uint32x4_t next = vsha256su0q_u32(message[n & 3], message[n + 1 & 3]);
+          message[n & 3] = vsha256su1q_u32(next, message[n + 2 & 3], message[n + 3 & 3]);
+        }
+        uint32x4_t previous = state0;
+        state0 = vsha256hq_u32(state0, state1, rounds);
+        state1 = vsha256h2q_u32(state1, previous, rounds);
+      }
+      state0 = vaddq_u32(state0, save0);
+      state1 = vaddq_u32(state1, save1);
+      data += 64;
+    }
+
+    vst1q_u32(&h[0], state0);
+    vst1q_u32(&h[4], state1);
+  }
+  #endif
+
   auto finish() -> void {
     byte(0x80);
     while(queued != 56) byte(0x00);
@@ -83,6 +182,10 @@ private:
   }
 
   auto cube(u32 n) -> u32 {
+    return cubes()[n];
+  }
+
+  static auto cubes() -> const u32* {
     static const u32 value[64] = {
       0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
       0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
@@ -93,7 +196,7 @@ private:
       0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
       0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2,
     };
-    return value[n];
+    return value;
   }
 
   u32 queue[16] = {};
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <new>
+#include <nall/traits.hpp>
+
+namespace nall {
+
+//a non-allocating alternative to nall::function for dispatch tables on hot paths:
+//the callable is stored inside the object and invoked through a plain function pointer.
+//only trivially copyable callables up to Capacity bytes in size may be stored.
+template<typename T, u32 Capacity = 4 * sizeof(void*)> struct inline_function;
+
+template<typename R, typename... P, u32 Capacity> struct inline_function<auto (P...) -> R, Capacity> {
+  //value = true if auto L::operator()(P...) -> R exists
+  template<typename L> struct is_compatible {
+    template<typename T> static auto exists(T*) -> const typename is_same<R, decltype(declval<T>().operator()(declval<P>()...))>::type;
+    template<typename T> static auto exists(...) -> const false_type;
+    static constexpr bool value = decltype(exists<L>(0))::value;
+  };
+
+  inline_function() {}
+  inline_function(auto (*function)(P...) -> R) { assign(function); }
+  template<typename C> inline_function(auto (C::*function)(P...) -> R, C* object) { assign(member<C>{function, object}); }
+  template<typename C> inline_function(auto (C::*function)(P...) const -> R, const C* object) { assign(const_member<C>{function, object}); }
+  template<typename L, typename = enable_if_t<is_compatible<L>::value>> inline_function(const L& object) { assign(object); }
+
+  explicit operator bool() const { return invoke; }
+  auto operator()(P... p) const -> R { return invoke(storage, std::forward<P>(p)...); }
+  auto reset() -> void { invoke = nullptr; }
+
+private:
+  template<typename L> auto assign(const L& object) -> void {
+    static_assert(sizeof(L) <= Capacity, "callable is too large for inline_function");
+    static_assert(alignof(L) <= alignof(void*), "callable is over-aligned for inline_function");
+    static_assert(is_trivially_copyable_v<L> && is_trivially_destructible_v<L>, "callable must be trivially copyable");
+    new(storage) L(object);
+    invoke = [](const void* storage, P... p) -> R { return (*(L*)storage)(std::forward<P>(p)...); };
+  }
+
+  template<typename C> struct member {
+    auto (C::*function)(P...) -> R;
+    C* object;
+    auto operator()(P... p) const -> R { return (object->*function)(std::forward<P>(p)...); }
+  };
+
+  template<typename C> struct const_member {
+    auto (C::*function)(P...) const -> R;
+    const C* object;
+    auto operator()(P... p) const -> R { return (object->*function)(std::forward<P>(p)...); }
+  };
+
+  auto (*invoke)(const void*, P...) -> R = nullptr;
+  alignas(void*) u8 storage[Capacity];
+};
+
+}
@@ -26,6 +26,7 @@
 #include <nall/hashset.hpp>
 #include <nall/hid.hpp>
 #include <nall/image.hpp>
+#include <nall/inline-function.hpp>
 #include <nall/inode.hpp>
 #include <nall/instance.hpp>
 #include <nall/interpolation.hpp>
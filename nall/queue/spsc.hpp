@@ -1,7 +1,10 @@
 #pragma once
 
+#include <condition_variable>
+
 //single-producer, single-consumer lockless queue
 //includes await functions for spin-loops
+//blocking queues spin briefly and then sleep until the other side makes progress
 
 namespace nall {
 
@@ -9,6 +12,13 @@ template<typename T> struct queue_spsc;
 
 template<typename T, u32 Size>
 struct queue_spsc<T[Size]> {
+  //number of spinloop() iterations before a blocking queue sleeps
+  static constexpr u32 Spins = 4096;
+
+  auto setBlocking(bool blocking) -> void {
+    _blocking = blocking;
+  }
+
   auto flush() -> void {
     _read  = 0;
     _write = 2 * Size;
@@ -30,6 +40,7 @@ struct queue_spsc<T[Size]> {
     if(empty()) return nothing;
     auto value = _data[_read % Size];
     _read = _read + 1 < 2 * Size ? _read + 1 : 0;
+    wake();
     return value;
   }
 
@@ -37,30 +48,58 @@ struct queue_spsc<T[Size]> {
     if(full()) return false;
     _data[_write % Size] = value;
     _write = _write + 1 < 4 * Size ? _write + 1 : 2 * Size;
+    wake();
     return true;
   }
 
   auto await_empty() -> void {
-    while(!empty()) spinloop();
+    await([&] { return empty(); });
   }
 
   auto await_read() -> T {
-    while(empty()) spinloop();
+    await([&] { return !empty(); });
     auto value = _data[_read % Size];
     _read = _read + 1 < 2 * Size ? _read + 1 : 0;
+    wake();
     return value;
   }
 
   auto await_write(const T& value) -> void {
-    while(full()) spinloop();
+    await([&] { return !full(); });
     _data[_write % Size] = value;
     _write = _write + 1 < 4 * Size ? _write + 1 : 2 * Size;
+    wake();
   }
 
 private:
+  template<typename F> auto await(const F& ready) -> void {
+    for(u32 spins = 0; !ready(); spins++) {
+      if(!_blocking || spins < Spins) {
+        spinloop();
+        continue;
+      }
+      //_waiting must be raised before ready() is checked again, so that wake() cannot miss this thread
+      std::unique_lock<std::mutex> lock(_mutex);
+      _waiting++;
+      _condition.wait(lock, ready);
+      _waiting--;
+      return;
+    }
+  }
+
+  auto wake() -> void {
+    if(!_waiting) return;
+    std::lock_guard<std::mutex> lock(_mutex);
+    _condition.notify_all();
+  }
+
   T _data[Size];
   std::atomic<u32> _read  = 0;
   std::atomic<u32> _write = 2 * Size;
+  std::atomic<u32> _waiting = 0;
+  bool _blocking = false;
+  std::mutex _mutex;
+  std::condition_variable _condition;
 };
 
 }
@@ -110,6 +110,14 @@
                           y.fst, y.snd);
   }
 
+  template<typename T, typename U>
+  auto cmp64_jump(T x, U y, sljit_s32 flags) -> sljit_jump* {
+    return sljit_emit_cmp(compiler,
+                          flags,
+                          x.fst, x.snd,
+                          y.fst, y.snd);
+  }
+
   //flag instructions
 
 #define OPF(name, op) \
@@ -0,0 +1,105 @@
+#pragma once
+
+//{
+#if defined(ARCHITECTURE_AMD64)
+  //raw SSE instructions, emitted through sljit_emit_op_custom().
+  //sljit does not allocate vector registers: xmm0-xmm5 are volatile in every amd64 ABI,
+  //while xmm6-xmm15 may only be used by functions begun with vectors = true, so that
+  //they are preserved on Windows. none of them are preserved across calls to other functions.
+
+  struct xmm {
+    explicit xmm(u8 index) : index(index) { assert(index < 16); }
+    u8 index;
+  };
+
+  //prefix (66/f3), opcode map (0f, 0f38, 0f3a), opcode, and either a register or [base + displacement] operand
+  auto sse(u8 prefix, u8 map, u8 opcode, u8 r, sljit_s32 base, sljit_sw displacement, bool memory, s32 immediate = -1) -> void {
+    u8 code[16];
+    u32 size = 0;
+    u8 rm = memory ? sljit_get_register_index(base) : base;
+    u8 rex = 0x40 | (r >> 3 & 1) << 2 | (rm >> 3 & 1);
+    if(prefix) code[size++] = prefix;
+    if(rex != 0x40) code[size++] = rex;
+    code[size++] = 0x0f;
+    if(map) code[size++] = map;
+    code[size++] = opcode;
+    if(!memory) {
+      code[size++] = 0xc0 | (r & 7) << 3 | (rm & 7);
+    } else {
+      code[size++] = 0x80 | (r & 7) << 3 | (rm & 7);
+      if((rm & 7) == 4) code[size++] = 0x24;  //SIB byte required for rsp/r12 base
+      for(u32 n : range(4)) code[size++] = (s32)displacement >> n * 8;
+    }
+    if(immediate >= 0) code[size++] = immediate;
+    sljit_emit_op_custom(compiler, code, size);
+  }
+
+  //unaligned loads and stores are used, as they are no slower than aligned ones on aligned data
+  template<typename B>
+  auto movdqu(xmm x, B base, sljit_sw offset) {
+    sse(0xf3, 0, 0x6f, x.index, base.fst, offset, true);
+  }
+
+  template<typename B>
+  auto movdqu(B base, sljit_sw offset, xmm x) {
+    sse(0xf3, 0, 0x7f, x.index, base.fst, offset, true);
+  }
+
+  //64-bit loads and stores of the low quadword; loads clear the high quadword
+  template<typename B>
+  auto movq(xmm x, B base, sljit_sw offset) {
+    sse(0xf3, 0, 0x7e, x.index, base.fst, offset, true);
+  }
+
+  template<typename B>
+  auto movq(B base, sljit_sw offset, xmm x) {
+    sse(0x66, 0, 0xd6, x.index, base.fst, offset, true);
+  }
+
+  auto pshufd(xmm x, xmm y, u8 order) {
+    sse(0x66, 0, 0x70, x.index, y.index, 0, false, order);
+  }
+
+  auto pblendw(xmm x, xmm y, u8 select) {
+    sse(0x66, 0x3a, 0x0e, x.index, y.index, 0, false, select);
+  }
+
+#define OPX(name, map, opcode) \
+  auto name(xmm x, xmm y) { \
+    sse(0x66, map, opcode, x.index, y.index, 0, false); \
+  }
+
+  OPX(movdqa,    0x00, 0x6f)
+  OPX(pand,      0x00, 0xdb)
+  OPX(pandn,     0x00, 0xdf)
+  OPX(por,       0x00, 0xeb)
+  OPX(pxor,      0x00, 0xef)
+  OPX(paddw,     0x00, 0xfd)
+  OPX(paddsw,    0x00, 0xed)
+  OPX(paddusw,   0x00, 0xdd)
+  OPX(psubw,     0x00, 0xf9)
+  OPX(psubsw,    0x00, 0xe9)
+  OPX(pminsw,    0x00, 0xea)
+  OPX(pmaxsw,    0x00, 0xee)
+  OPX(pcmpeqw,   0x00, 0x75)
+  OPX(pcmpgtw,   0x00, 0x65)
+  OPX(pmullw,    0x00, 0xd5)
+  OPX(pmulhw,    0x00, 0xe5)
+  OPX(pmulhuw,   0x00, 0xe4)
+  OPX(punpcklwd, 0x00, 0x61)
+  OPX(punpckhwd, 0x00, 0x69)
+  OPX(packssdw,  0x00, 0x6b)
+  OPX(pshufb,    0x38, 0x00)
+#undef OPX
+
+#define OPS(name, ext) \
+  auto name(xmm x, u8 shift) { \
+    sse(0x66, 0, 0x71, ext, x.index, 0, false, shift); \
+  }
+
+  OPS(psrlw, 2)
+  OPS(psraw, 4)
+  OPS(psllw, 6)
+#undef OPS
+#endif
+//};
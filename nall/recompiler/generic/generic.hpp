@@ -12,8 +12,10 @@ namespace nall::recompiler {
     generic(bump_allocator& alloc) : allocator(alloc) {}
     ~generic() { resetCompiler(); }
 
-    auto beginFunction(int args) -> void {
-      assert(args <= 3);
+    //saveds may be raised up to SLJIT_NUMBER_OF_SAVED_REGISTERS to keep more values in host registers
+    //vectors reserves every host floating point register, for code that holds values in them
+    auto beginFunction(int args, int saveds = 3, bool vectors = false) -> void {
+      assert(args <= 3 && saveds >= 3 && saveds <= SLJIT_NUMBER_OF_SAVED_REGISTERS);
       resetCompiler();
       compiler = sljit_create_compiler(nullptr, &allocator);
 
@@ -21,7 +23,9 @@ namespace nall::recompiler {
       if(args >= 1) options |= SLJIT_ARG_VALUE(SLJIT_ARG_TYPE_W, 1);
       if(args >= 2) options |= SLJIT_ARG_VALUE(SLJIT_ARG_TYPE_W, 2);
       if(args >= 3) options |= SLJIT_ARG_VALUE(SLJIT_ARG_TYPE_W, 3);
-      sljit_emit_enter(compiler, 0, options, 4, 3, 0, 0, 0);
+      sljit_s32 fscratches = vectors ? SLJIT_NUMBER_OF_SCRATCH_FLOAT_REGISTERS : 0;
+      sljit_s32 fsaveds = vectors ? SLJIT_NUMBER_OF_SAVED_FLOAT_REGISTERS : 0;
+      sljit_emit_enter(compiler, 0, options, 4, saveds, fscratches, fsaveds, 0);
       sljit_jump* entry = sljit_emit_jump(compiler, SLJIT_JUMP);
       epilogue = sljit_emit_label(compiler);
       sljit_emit_return_void(compiler);
@@ -64,6 +68,7 @@ namespace nall::recompiler {
     #include "constants.hpp"
     #include "encoder-instructions.hpp"
     #include "encoder-calls.hpp"
+    #include "encoder-sse.hpp"
   };
 }
 #endif
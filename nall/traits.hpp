@@ -32,6 +32,10 @@ namespace nall {
   using std::is_same_v;
   using std::is_signed;
   using std::is_signed_v;
+  using std::is_trivially_copyable;
+  using std::is_trivially_copyable_v;
+  using std::is_trivially_destructible;
+  using std::is_trivially_destructible_v;
   using std::is_unsigned;
   using std::is_unsigned_v;
   using std::nullptr_t;
@@ -21,6 +21,8 @@ PFNGLGENBUFFERSPROC glGenBuffers = nullptr;
 PFNGLDELETEBUFFERSPROC glDeleteBuffers = nullptr;
 PFNGLBINDBUFFERPROC glBindBuffer = nullptr;
 PFNGLBUFFERDATAPROC glBufferData = nullptr;
+PFNGLMAPBUFFERRANGEPROC glMapBufferRange = nullptr;
+PFNGLUNMAPBUFFERPROC glUnmapBuffer = nullptr;
 PFNGLGETATTRIBLOCATIONPROC glGetAttribLocation = nullptr;
 PFNGLVERTEXATTRIBPOINTERPROC glVertexAttribPointer = nullptr;
 PFNGLENABLEVERTEXATTRIBARRAYPROC glEnableVertexAttribArray = nullptr;
@@ -72,6 +74,8 @@ static bool OpenGLBind() {
   bind(PFNGLDELETEBUFFERSPROC, glDeleteBuffers);
   bind(PFNGLBINDBUFFERPROC, glBindBuffer);
   bind(PFNGLBUFFERDATAPROC, glBufferData);
+  bind(PFNGLMAPBUFFERRANGEPROC, glMapBufferRange);
+  bind(PFNGLUNMAPBUFFERPROC, glUnmapBuffer);
   bind(PFNGLGETATTRIBLOCATIONPROC, glGetAttribLocation);
   bind(PFNGLVERTEXATTRIBPOINTERPROC, glVertexAttribPointer);
   bind(PFNGLENABLEVERTEXATTRIBARRAYPROC, glEnableVertexAttribArray);
@@ -84,15 +84,34 @@ auto OpenGL::clear() -> void {
 
 auto OpenGL::lock(u32*& data, u32& pitch) -> bool {
   pitch = width * sizeof(u32);
+  if(pixelBuffer) {
+    //orphan the previous frame's storage so mapping never waits on an upload still in flight
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, pixelBuffer);
+    if(mapped) glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+    glBufferData(GL_PIXEL_UNPACK_BUFFER, pitch * height, nullptr, GL_STREAM_DRAW);
+    mapped = (u32*)glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, pitch * height, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    if(mapped) return data = mapped;
+  }
   return data = buffer;
 }
 
 auto OpenGL::output() -> void {
   clear();
 
+  //when the frame was written into the mapped pixel buffer, uploads source from it (offset 0) rather than from buffer
+  bool unpack = mapped;
+  const void* pixels = unpack ? nullptr : buffer;
+  if(unpack) {
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, pixelBuffer);
+    glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+    mapped = nullptr;
+  }
+
   glActiveTexture(GL_TEXTURE0);
   glBindTexture(GL_TEXTURE_2D, texture);
-  glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, width, height, getFormat(), getType(), buffer);
+  glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, width, height, getFormat(), getType(), pixels);
+  glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
 
   struct Source {
     GLuint texture;
@@ -174,11 +193,13 @@ auto OpenGL::output() -> void {
     OpenGLTexture frame = history.takeRight();
 
     glBindTexture(GL_TEXTURE_2D, frame.texture);
+    if(unpack) glBindBuffer(GL_PIXEL_UNPACK_BUFFER, pixelBuffer);
     if(width == frame.width && height == frame.height) {
-      glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, width, height, getFormat(), getType(), buffer);
+      glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, width, height, getFormat(), getType(), pixels);
     } else {
-      glTexImage2D(GL_TEXTURE_2D, 0, format, frame.width = width, frame.height = height, 0, getFormat(), getType(), buffer);
+      glTexImage2D(GL_TEXTURE_2D, 0, format, frame.width = width, frame.height = height, 0, getFormat(), getType(), pixels);
     }
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
 
     history.prepend(frame);
   }
@@ -199,6 +220,7 @@ auto OpenGL::initialize(const string& shader) -> bool {
   fragment = glrCreateShader(program, GL_FRAGMENT_SHADER, OpenGLFragmentShader);
   OpenGLSurface::allocate();
   glrLinkProgram(program);
+  glGenBuffers(1, &pixelBuffer);
 
   setShader(shader);
   return initialized = true;
@@ -207,6 +229,14 @@ auto OpenGL::initialize(const string& shader) -> bool {
 auto OpenGL::terminate() -> void {
   if(!initialized) return;
   setShader("");  //release shader resources (eg frame[] history)
+  if(pixelBuffer) {
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, pixelBuffer);
+    if(mapped) glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    glDeleteBuffers(1, &pixelBuffer);
+    pixelBuffer = 0;
+    mapped = nullptr;
+  }
   OpenGLSurface::release();
   if(buffer) { delete[] buffer; buffer = nullptr; }
   initialized = false;
@@ -80,6 +80,8 @@ struct OpenGL : OpenGLProgram {
   u32 outputY = 0;
   u32 outputWidth = 0;
   u32 outputHeight = 0;
+  GLuint pixelBuffer = 0;  //pixel unpack buffer that lock() maps for the frontend to write into
+  u32* mapped = nullptr;
   struct Setting {
     string name;
     string value;
@@ -0,0 +1,93 @@
+//dispatch: compares the cost of calling through a 256-entry table of nall::function against
+//nall::inline_function, using the member function and lambda callables that bus handlers use.
+
+#include <nall/nall.hpp>
+#include <nall/main.hpp>
+using namespace nall;
+
+static u32 failures = 0;
+
+static auto check(const string& name, bool result) -> void {
+  if(result) return;
+  print("FAIL ", name, "\n");
+  failures++;
+}
+
+struct Device {
+  auto read(u32 address, u8 data) -> u8 { return memory[address & 0xff] ^ data; }
+  auto write(u32 address, u8 data) -> void { memory[address & 0xff] += data; }
+  auto peek(u32 address, u8 data) const -> u8 { return memory[address & 0xff] + data; }
+  u8 memory[256] = {};
+};
+
+template<template<typename> typename F> struct Table {
+  Table(Device* devices) {
+    for(u32 id : range(256)) {
+      if(id & 1) {
+        reader[id] = {&Device::read, &devices[id & 7]};
+        writer[id] = {&Device::write, &devices[id & 7]};
+      } else {
+        auto device = &devices[id & 7];
+        reader[id] = [device](u32 address, u8 data) -> u8 { return device->read(address, data); };
+        writer[id] = [device](u32 address, u8 data) -> void { return device->write(address, data); };
+      }
+    }
+  }
+
+  F<auto (u32, u8) -> u8> reader[256];
+  F<auto (u32, u8) -> void> writer[256];
+};
+
+template<template<typename> typename F> static auto measure(const string& name, const vector<u8>& lookup) -> u64 {
+  Device devices[8];
+  Table<F> table{devices};
+  u8 data = 0;
+  auto begin = chrono::nanosecond();
+  for(u32 pass : range(256)) {
+    for(u32 address : range(lookup.size())) {
+      u32 id = lookup[address];
+      data = table.reader[id](address, data);
+      table.writer[id](address, data);
+    }
+  }
+  auto end = chrono::nanosecond();
+  print(pad(name, -24L), (f64)(end - begin) / (256 * lookup.size() * 2), " ns/call\n");
+  u64 checksum = data;
+  for(auto& device : devices) for(auto byte : device.memory) checksum = checksum * 31 + byte;
+  return checksum;
+}
+
+template<typename T> using heap_function = function<T>;
+template<typename T> using inline_storage_function = inline_function<T>;
+
+auto nall::main(Arguments arguments) -> void {
+  //copies, resets and the callable kinds behave the same as nall::function
+  u32 counter = 0;
+  inline_function<auto () -> void> increment = [&] { counter++; };
+  auto copy = increment;
+  increment();
+  copy();
+  check("lambda", counter == 2);
+  increment.reset();
+  check("reset", !increment && (bool)copy);
+  inline_function<auto (u32) -> u32> global = [](u32 value) -> u32 { return value * 3; };
+  check("capture-less lambda", global(7) == 21);
+  Device device;
+  inline_function<auto (u32, u8) -> u8> member{&Device::read, &device};
+  device.memory[4] = 0x5a;
+  check("member", member(4, 0xff) == 0xa5);
+  inline_function<auto (u32, u8) -> u8> constMember{&Device::peek, &device};
+  check("const member", constMember(4, 1) == 0x5b);
+
+  //bus-like access pattern: mostly the same few handlers, with occasional switches
+  vector<u8> lookup;
+  lookup.resize(64_KiB);
+  for(u32 address : range(lookup.size())) lookup[address] = address >> 13 ^ (random() & 15) * (random() % 8 == 0);
+
+  u64 a = measure<heap_function>("function", lookup);
+  u64 b = measure<inline_storage_function>("inline_function", lookup);
+  check("results", a == b);
+
+  if(failures) print(failures, " failures\n");
+  else print("all tests passed\n");
+}
@@ -0,0 +1,86 @@
+//hash: checks the CRC32 and SHA-256 implementations against test vectors and each other,
+//then compares their throughput against hashing one byte at a time.
+
+#include <nall/nall.hpp>
+#include <nall/main.hpp>
+using namespace nall;
+
+static u32 failures = 0;
+static volatile u32 sink = 0;  //keeps the benchmarked results from being optimized away
+
+static auto check(const string& name, const string& result, const string& expected) -> void {
+  if(result == expected) return;
+  print("FAIL ", name, ": ", result, " != ", expected, "\n");
+  failures++;
+}
+
+//the bytewise input() path is the original implementation of each hash.
+template<typename H> static auto bytewise(const u8* data, u64 size) -> H {
+  H hash;
+  for(u64 n : range(size)) hash.input(data[n]);
+  return hash;
+}
+
+template<typename F> static auto measure(const string& name, u64 size, F&& function) -> void {
+  u32 iterations = 0;
+  auto begin = chrono::nanosecond();
+  auto end = begin;
+  do {
+    function();
+    iterations++;
+    end = chrono::nanosecond();
+  } while(end - begin < 250'000'000);
+  f64 seconds = (end - begin) / 1'000'000'000.0;
+  print(pad(name, -24L), size * iterations / 1048576.0 / seconds, " MiB/s\n");
+}
+
+auto nall::main(Arguments arguments) -> void {
+  auto& processor = Hash::Processor::features();
+  print("clmul: ", processor.clmul, ", crc32: ", processor.crc32, ", sha256: ", processor.sha256, "\n");
+
+  check("crc32 empty", hex(Hash::CRC32().value(), 8L), "00000000");
+  check("crc32 check", hex(Hash::CRC32(string{"123456789"}).value(), 8L), "cbf43926");
+  check("sha256 empty", Hash::SHA256().digest(), "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855");
+  check("sha256 abc", Hash::SHA256(string{"abc"}).digest(), "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad");
+  check("sha256 448 bits", Hash::SHA256(string{"abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq"}).digest(),
+    "248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1");
+  string million;
+  million.resize(1'000'000);
+  memory::fill(million.get(), million.size(), 'a');
+  check("sha256 million", Hash::SHA256(million).digest(), "cdc76e5c9914fb9281a1c7e284d73e67f1809a48a497200e046d39ccc7112cd0");
+
+  //every length and alignment near the block sizes, and some longer inputs split at random
+  vector<u8> buffer;
+  buffer.resize(1_MiB + 64);
+  for(auto& byte : buffer) byte = random();
+  for(u32 size : range(300)) {
+    for(u32 offset : range(16)) {
+      const u8* data = buffer.data() + offset;
+      u32 crc32 = bytewise<Hash::CRC32>(data, size).value();
+      check({"crc32 slice ", size, "+", offset}, hex(Hash::CRC32::slice(~0, data, size), 8L), hex(~crc32, 8L));
+      check({"crc32 update ", size, "+", offset}, hex(Hash::CRC32::update(~0, data, size), 8L), hex(~crc32, 8L));
+      check({"sha256 ", size, "+", offset}, Hash::SHA256({data, size}).digest(), bytewise<Hash::SHA256>(data, size).digest());
+    }
+  }
+  for(u32 trial : range(16)) {
+    u64 size = random() % 1_MiB;
+    u64 split = random() % (size + 1);
+    Hash::CRC32 crc32;
+    Hash::SHA256 sha256;
+    crc32.input(buffer.data(), split);
+    crc32.input(buffer.data() + split, size - split);
+    sha256.input(buffer.data(), split);
+    sha256.input(buffer.data() + split, size - split);
+    check({"crc32 split ", size}, crc32.digest(), bytewise<Hash::CRC32>(buffer.data(), size).digest());
+    check({"sha256 split ", size}, sha256.digest(), bytewise<Hash::SHA256>(buffer.data(), size).digest());
+  }
+  print(failures ? "test vectors failed\n" : "test vectors passed\n");
+
+  u64 size = 1_MiB;
+  const u8* data = buffer.data();
+  measure("crc32 bytewise", size, [&] { sink = sink + bytewise<Hash::CRC32>(data, size).value(); });
+  measure("crc32 slicing-by-8", size, [&] { sink = sink + Hash::CRC32::slice(~0, data, size); });
+  measure("crc32", size, [&] { sink = sink + Hash::CRC32({data, size}).value(); });
+  measure("sha256 bytewise", size, [&] { sink = sink + bytewise<Hash::SHA256>(data, size).output()[0]; });
+  measure("sha256", size, [&] { sink = sink + Hash::SHA256({data, size}).output()[0]; });
+}
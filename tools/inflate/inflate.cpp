@@ -0,0 +1,105 @@
+//inflate: compares the speed of puff against the table-driven Inflate decoder on the deflated files in zip archives.
+//every decoded file is also checked against the CRC32 recorded in the archive.
+
+#include <nall/nall.hpp>
+#include <nall/main.hpp>
+#include <nall/decode/zip.hpp>
+#include <nall/hash/crc32.hpp>
+using namespace nall;
+
+struct Result {
+  u64 bytes = 0;
+  u64 nanoseconds = 0;
+  u32 failures = 0;
+
+  auto report(const string& name) const -> void {
+    f64 seconds = nanoseconds / 1'000'000'000.0;
+    print(name, ": ", bytes / 1048576, " MiB in ", seconds, "s = ", seconds ? bytes / 1048576.0 / seconds : 0.0, " MiB/s");
+    if(failures) print(" (", failures, " failed)");
+    print("\n");
+  }
+};
+
+auto nall::main(Arguments arguments) -> void {
+  if(!arguments) return print("usage: inflate archive.zip [...] [--iterations=n]\n");
+  u32 iterations = 4;
+  for(auto& argument : arguments) {
+    if(argument.beginsWith("--iterations=")) iterations = max(1u, (u32)string{argument}.trimLeft("--iterations=", 1L).natural());
+  }
+
+  Result puff, oneshot, stream;
+  vector<u8> buffer;
+  auto chunk = new u8[65536];
+  auto inflater = new Decode::Inflate;
+
+  for(auto& location : arguments) {
+    if(location.beginsWith("--")) continue;
+    Decode::ZIP archive;
+    if(!archive.open(location)) {
+      print("failed to open: ", location, "\n");
+      continue;
+    }
+
+    for(auto& file : archive.file) {
+      if(file.cmode != 8) continue;
+      buffer.resize(file.size);
+
+      //puff is limited to 32-bit sizes
+      if(file.size <= 0xffffffff && file.csize <= 0xffffffff) {
+        bool valid = true;
+        auto begin = chrono::nanosecond();
+        for(u32 iteration : range(iterations)) {
+          u32 targetSize = file.size, sourceSize = file.csize;
+          valid &= Decode::puff::puff(buffer.data(), &targetSize, (u8*)file.data, &sourceSize) == 0;
+        }
+        auto end = chrono::nanosecond();
+        valid &= Hash::CRC32({buffer.data(), (u32)buffer.size()}).value() == file.crc32;
+        puff.bytes += file.size * iterations;
+        puff.nanoseconds += end - begin;
+        puff.failures += !valid;
+      }
+
+      memory::fill(buffer.data(), buffer.size());
+      {
+        bool valid = true;
+        auto begin = chrono::nanosecond();
+        for(u32 iteration : range(iterations)) {
+          valid &= inflater->decode(buffer.data(), buffer.size(), file.data, file.csize);
+        }
+        auto end = chrono::nanosecond();
+        valid &= Hash::CRC32({buffer.data(), (u32)buffer.size()}).value() == file.crc32;
+        oneshot.bytes += file.size * iterations;
+        oneshot.nanoseconds += end - begin;
+        oneshot.failures += !valid;
+      }
+
+      {
+        bool valid = true;
+        u64 nanoseconds = 0;
+        for(u32 iteration : range(iterations)) {
+          Hash::CRC32 crc32;
+          u64 size = 0;
+          auto begin = chrono::nanosecond();
+          archive.stream(file, *inflater);
+          while(u64 length = inflater->read(chunk, 65536)) {
+            nanoseconds += chrono::nanosecond() - begin;
+            crc32.input(chunk, length);
+            size += length;
+            begin = chrono::nanosecond();
+          }
+          nanoseconds += chrono::nanosecond() - begin;
+          valid &= inflater->finished() && size == file.size && crc32.value() == file.crc32;
+        }
+        stream.bytes += file.size * iterations;
+        stream.nanoseconds += nanoseconds;
+        stream.failures += !valid;
+      }
+    }
+  }
+
+  puff.report("puff");
+  oneshot.report("inflate");
+  stream.report("inflate (streamed)");
+  delete[] chunk;
+  delete inflater;
+}
@@ -0,0 +1,144 @@
+//throughput: measures the combined speed of several headless emulator instances.
+//each instance runs on its own host thread, which requires ares to be built with instances=threaded.
+
+#include <mia/mia.hpp>
+#include <fc/fc.hpp>
+#include <gb/gb.hpp>
+#include <ms/ms.hpp>
+#include <nall/main.hpp>
+#include <thread>
+
+#if !defined(THREADED_INSTANCES)
+  #error "throughput requires ares to be built with instances=threaded"
+#endif
+
+struct Emulator : ares::Platform {
+  auto load(const string& system) -> bool;
+  auto run(u32 frames) -> void;
+  auto unload() -> void;
+
+  auto pak(ares::Node::Object) -> shared_pointer<vfs::directory> override;
+  auto event(ares::Event) -> void override;
+  auto audio(ares::Node::Audio::Stream) -> void override;
+
+  ares::Node::System root;
+  shared_pointer<mia::Pak> system;
+  shared_pointer<mia::Pak> game;
+  u32 frames = 0;
+};
+
+//the system and game paks are shared read-only by every instance, but vfs::file keeps a
+//seek offset, so instances take turns loading. emulation itself then runs without locks.
+static std::mutex loading;
+
+auto Emulator::load(const string& name) -> bool {
+  std::lock_guard<std::mutex> lock(loading);
+  ares::platform = this;
+  if(name == "Famicom") {
+    if(!ares::Famicom::load(root, "[Nintendo] Famicom (NTSC-U)")) return false;
+  }
+  if(name == "Game Boy") {
+    if(!ares::GameBoy::load(root, "[Nintendo] Game Boy")) return false;
+  }
+  if(name == "Master System") {
+    if(!ares::MasterSystem::load(root, "[Sega] Master System (NTSC-U)")) return false;
+  }
+  if(!root) return false;
+
+  if(auto port = root->find<ares::Node::Port>("Cartridge Slot")) {
+    port->allocate();
+    port->connect();
+  }
+  for(auto id : range(2)) {
+    if(auto port = root->find<ares::Node::Port>(string{"Controller Port ", 1 + id})) {
+      port->allocate("Gamepad");
+      port->connect();
+    }
+  }
+
+  root->power();
+  return true;
+}
+
+auto Emulator::run(u32 limit) -> void {
+  while(frames < limit) root->run();
+}
+
+auto Emulator::unload() -> void {
+  std::lock_guard<std::mutex> lock(loading);
+  if(root) root->unload();
+  root.reset();
+}
+
+auto Emulator::pak(ares::Node::Object node) -> shared_pointer<vfs::directory> {
+  if(node->name() == system->name()) return system->pak;
+  if(node->name() == string{system->name(), " Cartridge"}) return game->pak;
+  return {};
+}
+
+auto Emulator::event(ares::Event event) -> void {
+  if(event == ares::Event::Frame) frames++;
+}
+
+auto Emulator::audio(ares::Node::Audio::Stream stream) -> void {
+  //discard audio so that the resampler queues do not grow without bound
+  f64 samples[8];
+  while(stream->pending()) stream->read(samples);
+}
+
+auto nall::main(Arguments arguments) -> void {
+  if(arguments.size() < 2) {
+    print("usage: throughput \"Famicom\"|\"Game Boy\"|\"Master System\" game [frames] [threads]\n");
+    return;
+  }
+
+  auto name = arguments.take();
+  auto location = arguments.take();
+  u32 frames = arguments ? arguments.take().natural() : 3600;
+  u32 limit = arguments ? arguments.take().natural() : std::thread::hardware_concurrency();
+  limit = max(1u, limit);
+
+  mia::setHomeLocation([]() -> string { return {Path::userData(), "ares/"}; });
+  mia::setSaveLocation([]() -> string { return {Path::userData(), "ares/Saves/"}; });
+  mia::construct();
+
+  auto system = mia::System::create(name);
+  auto game = mia::Medium::create(name);
+  if(!system || !game) return print("unsupported system: ", name, "\n");
+  if(!system->load() || !game->load(location)) return print("failed to load: ", location, "\n");
+
+  print("threads, frames/second, frames/second/thread, scaling\n");
+  f64 baseline = 0;
+  for(u32 threads = 1;; threads = min(threads * 2, limit)) {
+    vector<Emulator> instances;
+    instances.resize(threads);
+    for(auto& instance : instances) instance.system = system, instance.game = game;
+
+    std::atomic<u32> ready = 0;
+    std::atomic<bool> start = false;
+    std::atomic<bool> failed = false;
+    vector<std::thread> workers;
+    for(auto& instance : instances) {
+      workers.append(std::thread([&] {
+        if(!instance.load(name)) failed = true;
+        ready++;
+        while(!start) std::this_thread::yield();
+        if(!failed) instance.run(frames);
+        instance.unload();
+      }));
+    }
+
+    while(ready < threads) std::this_thread::yield();
+    auto begin = chrono::nanosecond();
+    start = true;
+    for(auto& worker : workers) worker.join();
+    auto end = chrono::nanosecond();
+    if(failed) return print("failed to start emulation\n");
+
+    f64 seconds = (end - begin) / 1'000'000'000.0;
+    f64 total = threads * frames / seconds;
+    if(threads == 1) baseline = total;
+    print(threads, ", ", total, ", ", total / threads, ", ", total / baseline, "\n");
+    if(threads == limit) break;
+  }
+}
@@ -0,0 +1,64 @@
+//trace: formats the binary instruction traces written by the desktop-ui trace logger as text,
+//in the same layout as the text trace logger, with changed registers in place of the disassembly.
+
+#include <nall/nall.hpp>
+#include <nall/main.hpp>
+using namespace nall;
+
+//mirrors ares::Core::Debugger::Tracer::Instruction::Record::Type
+enum class Type : u32 { Instruction, Register, Omitted, Dropped };
+
+auto nall::main(Arguments arguments) -> void {
+  if(arguments.size() != 2) return print("usage: trace input.trace output.log\n");
+
+  string inputName = arguments.take();
+  string outputName = arguments.take();
+
+  file_buffer input{inputName, file::mode::read};
+  if(!input || input.reads(4) != "ATRC") return print("error: not a binary trace\n");
+  if(u32 version = input.readl<u32>(4); version != 1) return print("error: unsupported trace version ", version, "\n");
+  u32 addressBits = input.readl<u32>(4);
+  string component = input.reads(input.readl<u32>(4));
+  if(input.size() - input.offset() & 15) print("warning: trace ends with a partial entry\n");
+
+  file_buffer output{outputName, file::mode::write};
+  if(!output) return print("error: unable to write ", outputName, "\n");
+
+  string line;
+  u64 instructions = 0;
+  auto flush = [&] {
+    if(!line) return;
+    output.print(line.strip(), "\n");
+    line.reset();
+  };
+
+  while(input.size() - input.offset() >= 16) {
+    u64 data = input.readl<u64>(8);
+    u32 code = input.readl<u32>(4);
+    auto type = (Type)input.readl<u32>(4);
+
+    switch(type) {
+    case Type::Instruction:
+      flush();
+      line = {component, "  ", hex(data, addressBits + 3 >> 2), "  ", hex(code, 8L), " "};
+      instructions++;
+      break;
+    case Type::Register:
+      line.append(" r", code, "=", hex(data));
+      break;
+    case Type::Omitted:
+      flush();
+      output.print("[Omitted: ", data, "]\n");
+      break;
+    case Type::Dropped:
+      flush();
+      output.print("[Dropped: ", data, "]\n");
+      break;
+    default:
+      return print("error: unknown entry type ", (u32)type, "\n");
+    }
+  }
+  flush();
+
+  print(instructions, " instructions\n");
+}